@@ -0,0 +1,761 @@
+#include "pareto_enumerator.hpp"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <deque>
+#include <future>
+#include <new>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+/*
+ * This is
+ *   benchmarks.cpp
+ * that is part of the ParetoFrontEnumerationAlgorithm library, available from
+ *   https://github.com/progirep/ParetoFrontEnumerationAlgorithm
+ *
+ * Is ia a library for enumerating all elements of a Pareto front for a
+ * multi-criterial optimization problem for which all optimization objectives
+ * have a finite range.
+ *
+ * The library and all of its files are distributed under the following license:
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015 Ruediger Ehlers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+using namespace paretoenumerator;
+
+//=================================================================================
+// Memory accounting: every allocation of the program is counted, so that the
+// benchmarks can report the peak memory of a run
+//=================================================================================
+static std::atomic<size_t> currentHeapBytes(0);
+static std::atomic<size_t> peakHeapBytes(0);
+static const size_t allocationHeaderSize = 16; // Keeps the alignment of the returned memory
+
+void *operator new(size_t size) {
+    char *memory = static_cast<char*>(std::malloc(size+allocationHeaderSize));
+    if (memory==NULL) throw std::bad_alloc();
+    *reinterpret_cast<size_t*>(memory) = size;
+    size_t current = (currentHeapBytes += size);
+    size_t peak = peakHeapBytes.load();
+    while ((current>peak) && !peakHeapBytes.compare_exchange_weak(peak,current)) {}
+    return memory+allocationHeaderSize;
+}
+
+void operator delete(void *pointer) noexcept {
+    if (pointer==NULL) return;
+    char *memory = static_cast<char*>(pointer)-allocationHeaderSize;
+    currentHeapBytes -= *reinterpret_cast<size_t*>(memory);
+    std::free(memory);
+}
+
+void operator delete(void *pointer, size_t) noexcept {
+    operator delete(pointer);
+}
+
+/**
+ * @brief Makes the current heap usage the new peak, so that the next call to "peakHeapBytesSince" reports the
+ * additional memory needed from now on.
+ */
+size_t resetPeakHeapBytes() {
+    size_t current = currentHeapBytes.load();
+    peakHeapBytes = current;
+    return current;
+}
+
+size_t peakHeapBytesSince(size_t start) {
+    return peakHeapBytes.load()-start;
+}
+
+//=================================================================================
+// Synthetic Pareto fronts. All objectives are minimized with values from 0 to
+// "range". The points lie on the surface "sum_i (x_i/range)^p = 1", with p=1 for
+// linear fronts, p=2 for concave ones and p=1/2 for convex ones. Clustered fronts
+// are linear fronts on which the points are concentrated around a few centers.
+//=================================================================================
+enum FrontShape { LINEAR, CONCAVE, CONVEX, CLUSTERED };
+
+/**
+ * @brief Draws a point that is uniformly distributed on the standard simplex
+ */
+void drawFromSimplex(std::mt19937 &rng, std::vector<double> &weights) {
+    std::exponential_distribution<double> exponential(1.0);
+    double sum = 0.0;
+    for (auto &w : weights) sum += (w = exponential(rng));
+    for (auto &w : weights) w /= sum;
+}
+
+/**
+ * @brief Generates a front with "nofPoints" points, or as many as the range permits. The points are
+ * pairwise incomparable and the same seed always gives the same front.
+ */
+PointSet makeFront(FrontShape shape, size_t nofDimensions, size_t nofPoints, int range, unsigned int seed) {
+    std::mt19937 rng(seed);
+    const size_t nofClusters = nofDimensions+1;
+    std::vector<std::vector<double> > clusterCenters(nofClusters,std::vector<double>(nofDimensions));
+    for (auto &center : clusterCenters) drawFromSimplex(rng,center);
+
+    std::vector<double> weights(nofDimensions);
+    std::vector<std::vector<int> > candidates;
+    PointSet front(nofDimensions);
+    for (unsigned int attempt=0;(attempt<20) && (front.size()<nofPoints);attempt++) {
+        while (candidates.size()<nofPoints+attempt*nofPoints/2) {
+            drawFromSimplex(rng,weights);
+            std::vector<int> point(nofDimensions);
+            for (size_t d=0;d<nofDimensions;d++) {
+                double value = weights[d];
+                if (shape==CONCAVE) {
+                    double norm = 0.0;
+                    for (auto w : weights) norm += w*w;
+                    value /= std::sqrt(norm);
+                } else if (shape==CONVEX) {
+                    value *= value;
+                } else if (shape==CLUSTERED) {
+                    const std::vector<double> &center = clusterCenters[candidates.size() % nofClusters];
+                    value = 0.95*center[d]+0.05*value;
+                }
+                point[d] = static_cast<int>(std::floor(value*range+0.5));
+            }
+            candidates.push_back(point);
+        }
+
+        // Keep the distinct minimal points. "cleanParetoFront" keeps the maximal ones, so it gets the negated points.
+        std::sort(candidates.begin(),candidates.end());
+        candidates.erase(std::unique(candidates.begin(),candidates.end()),candidates.end());
+        PointSet negated(nofDimensions);
+        for (auto const &point : candidates) {
+            std::vector<int> negatedPoint(point.size());
+            for (size_t d=0;d<nofDimensions;d++) negatedPoint[d] = -point[d];
+            negated.push_back(negatedPoint);
+        }
+        PointSet cleaned = cleanParetoFront(negated);
+        candidates.clear();
+        for (size_t i=0;i<cleaned.size();i++) {
+            std::vector<int> point(nofDimensions);
+            for (size_t d=0;d<nofDimensions;d++) point[d] = -cleaned[i][d];
+            candidates.push_back(point);
+        }
+        front = PointSet(nofDimensions);
+        for (size_t i=0;(i<candidates.size()) && (i<nofPoints);i++) front.push_back(candidates[i]);
+    }
+    return front;
+}
+
+/**
+ * @brief The feasibility function for a known front: a point is feasible if it is pointwise greater than or equal to
+ * some point of the front. It can simulate a more expensive objective function by waiting "latency" for every call.
+ */
+class FrontOracle {
+    detail::PointIndex<0> front;
+    const std::chrono::nanoseconds latency;
+public:
+    FrontOracle(const PointSet &points, std::chrono::nanoseconds _latency) : front(points.dimensions()), latency(_latency) {
+        for (size_t i=0;i<points.size();i++) front.insert(points[i]);
+    }
+    bool operator()(const std::vector<int> &point) {
+        if (latency.count()>0) {
+            // Busy waiting gives more precise latencies than sleeping
+            std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now()+latency;
+            while (std::chrono::steady_clock::now()<end) {}
+        }
+        return front.containsLeq(point.data());
+    }
+};
+
+//=================================================================================
+// Benchmarks for enumerating fronts. Arguments: shape, dimensions, number of
+// points, range, oracle latency in microseconds, and whether the points may be
+// stored with packed coordinates.
+//=================================================================================
+/**
+ * @brief Enumerates a synthetic front in every iteration and reports the statistics of the last run
+ */
+void runEnumerationBenchmark(benchmark::State &state, FrontShape shape, size_t nofDimensions, size_t nofPoints, int range, std::chrono::nanoseconds latency, EnumerationOptions options) {
+    PointSet front = makeFront(shape,nofDimensions,nofPoints,range,1);
+    FrontOracle oracle(front,latency);
+    std::vector<std::pair<int,int> > limits(nofDimensions,std::pair<int,int>(0,range));
+
+    EnumerationStats stats;
+    options.stats = &stats;
+    size_t peakBytes = 0;
+    for (auto _ : state) {
+        PointSet result;
+        size_t startBytes = resetPeakHeapBytes();
+        enumerateParetoFront(oracle,limits,result,options);
+        peakBytes = std::max(peakBytes,peakHeapBytesSince(startBytes));
+        if (result.size()!=front.size()) {
+            state.SkipWithError("The enumerated front has the wrong size.");
+            return;
+        }
+    }
+    state.counters["pareto_points"] = static_cast<double>(front.size());
+    state.counters["oracle_calls"] = static_cast<double>(stats.nofOracleCalls);
+    state.counters["co_pareto_calls"] = static_cast<double>(stats.nofCoParetoOracleCalls);
+    state.counters["calls_per_point"] = static_cast<double>(stats.nofOracleCalls)/std::max(front.size(),size_t(1));
+    state.counters["max_co_pareto"] = static_cast<double>(stats.maxNofCoParetoElements);
+    state.counters["oracle_s"] = stats.oracleTime;
+    state.counters["bookkeeping_s"] = stats.bookkeepingTime;
+    state.counters["peak_memory"] = benchmark::Counter(static_cast<double>(peakBytes),benchmark::Counter::kDefaults,benchmark::Counter::OneK::kIs1024);
+}
+
+void BM_EnumerateParetoFront(benchmark::State &state) {
+    EnumerationOptions options;
+    options.packCoordinates = state.range(5)!=0;
+    runEnumerationBenchmark(state,static_cast<FrontShape>(state.range(0)),static_cast<size_t>(state.range(1)),static_cast<size_t>(state.range(2)),
+        static_cast<int>(state.range(3)),std::chrono::microseconds(state.range(4)),options);
+}
+
+void enumerationArguments(benchmark::internal::Benchmark *benchmark) {
+    benchmark->ArgNames({"shape","dims","points","range","latency_us","packed"});
+    const long long sizes[][2] = {{2,100},{2,1000},{2,10000},{2,100000},{3,100},{3,1000},{3,10000},{4,100},{4,1000},{6,100},{10,20},{20,5}};
+    for (long long shape=LINEAR;shape<=CLUSTERED;shape++) {
+        for (auto const &size : sizes) benchmark->Args({shape,size[0],size[1],1000000,0,1});
+    }
+    // Narrow ranges, where the search for Pareto points is short but many points of the front coincide. The points
+    // are then stored with 16 or 8 bits per coordinate, which is compared with storing them unpacked.
+    for (long long packed : {0,1}) {
+        benchmark->Args({LINEAR,3,10000,60000,0,packed});
+        benchmark->Args({LINEAR,3,1000,1000,0,packed});
+        benchmark->Args({LINEAR,4,1000,100,0,packed});
+        benchmark->Args({LINEAR,6,1000,100,0,packed});
+        benchmark->Args({LINEAR,8,200,50,0,packed});
+    }
+    // Expensive feasibility functions
+    benchmark->Args({LINEAR,3,100,1000000,10,1});
+    benchmark->Args({LINEAR,3,100,1000000,100,1});
+}
+
+BENCHMARK(BM_EnumerateParetoFront)->Apply(enumerationArguments)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+//=================================================================================
+// Benchmarks for the order in which co-Pareto elements are tested. Arguments:
+// shape, dimensions, number of points, range, and the CoParetoSelection value.
+// As "SELECT_BY_PRIORITY" example, elements with large coordinate sums go first.
+//=================================================================================
+void BM_CoParetoSelection(benchmark::State &state) {
+    EnumerationOptions options;
+    options.selection = static_cast<CoParetoSelection>(state.range(4));
+    options.selectionPriority = [](const std::vector<int> &point) {
+        double sum = 0.0;
+        for (int value : point) sum += value;
+        return sum;
+    };
+    runEnumerationBenchmark(state,static_cast<FrontShape>(state.range(0)),static_cast<size_t>(state.range(1)),static_cast<size_t>(state.range(2)),
+        static_cast<int>(state.range(3)),std::chrono::nanoseconds(0),options);
+}
+
+void selectionArguments(benchmark::internal::Benchmark *benchmark) {
+    benchmark->ArgNames({"shape","dims","points","range","selection"});
+    const long long sizes[][3] = {{2,1000,1000000},{3,1000,1000000},{4,300,1000000},{6,100,1000000},{4,1000,100}};
+    for (long long shape : {LINEAR,CONCAVE,CLUSTERED}) {
+        for (auto const &size : sizes) {
+            for (long long selection=SELECT_IN_INDEX_ORDER;selection<=SELECT_LARGEST_GAP_FIRST;selection++) benchmark->Args({shape,size[0],size[1],size[2],selection});
+        }
+    }
+}
+
+BENCHMARK(BM_CoParetoSelection)->Apply(selectionArguments)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+//=================================================================================
+// Benchmarks for the order in which the search for a Pareto point lowers the
+// dimensions. Arguments: shape, dimensions, number of points, range, and the
+// DimensionOrder value. "calls_per_point" is the figure to compare.
+//=================================================================================
+void BM_DimensionOrder(benchmark::State &state) {
+    EnumerationOptions options;
+    options.dimensionOrder = static_cast<DimensionOrder>(state.range(4));
+    runEnumerationBenchmark(state,static_cast<FrontShape>(state.range(0)),static_cast<size_t>(state.range(1)),static_cast<size_t>(state.range(2)),
+        static_cast<int>(state.range(3)),std::chrono::nanoseconds(0),options);
+}
+
+void dimensionOrderArguments(benchmark::internal::Benchmark *benchmark) {
+    benchmark->ArgNames({"shape","dims","points","range","order"});
+    const long long sizes[][3] = {{2,1000,1000000},{3,1000,1000000},{4,300,1000000},{6,100,1000000},{4,1000,100}};
+    for (long long shape : {LINEAR,CONCAVE,CLUSTERED}) {
+        for (auto const &size : sizes) {
+            for (long long order=SEARCH_IN_INDEX_ORDER;order<=SEARCH_ADAPTIVE;order++) benchmark->Args({shape,size[0],size[1],size[2],order});
+        }
+    }
+}
+
+BENCHMARK(BM_DimensionOrder)->Apply(dimensionOrderArguments)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+//=================================================================================
+// Benchmarks for the search for the smallest feasible value in a dimension.
+// Arguments: shape, dimensions, number of points, range, and the ValueSearch
+// value.
+//=================================================================================
+void BM_ValueSearch(benchmark::State &state) {
+    EnumerationOptions options;
+    options.valueSearch = static_cast<ValueSearch>(state.range(4));
+    runEnumerationBenchmark(state,static_cast<FrontShape>(state.range(0)),static_cast<size_t>(state.range(1)),static_cast<size_t>(state.range(2)),
+        static_cast<int>(state.range(3)),std::chrono::nanoseconds(0),options);
+}
+
+void valueSearchArguments(benchmark::internal::Benchmark *benchmark) {
+    benchmark->ArgNames({"shape","dims","points","range","search"});
+    const long long sizes[][3] = {{2,1000,1000000},{3,1000,1000000},{4,300,1000000},{3,1000,1000},{4,1000,100}};
+    for (long long shape : {LINEAR,CONVEX,CLUSTERED}) {
+        for (auto const &size : sizes) {
+            for (long long search=SEARCH_BY_BISECTION;search<=SEARCH_BY_GALLOPING_FROM_LIKELIER_END;search++) benchmark->Args({shape,size[0],size[1],size[2],search});
+        }
+    }
+}
+
+BENCHMARK(BM_ValueSearch)->Apply(valueSearchArguments)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+//=================================================================================
+// Benchmarks for warm starts. Arguments: shape, dimensions, number of points,
+// the percentage of the front that is given as seeds, and whether the seeds are
+// trusted. The seeds are every k-th point of the front.
+//=================================================================================
+void BM_WarmStart(benchmark::State &state) {
+    const FrontShape shape = static_cast<FrontShape>(state.range(0));
+    const size_t nofDimensions = static_cast<size_t>(state.range(1));
+    const size_t nofPoints = static_cast<size_t>(state.range(2));
+    const int range = 1000000;
+    PointSet front = makeFront(shape,nofDimensions,nofPoints,range,1);
+    WarmStart warmStart;
+    warmStart.paretoPoints = PointSet(nofDimensions);
+    const size_t nofSeeds = front.size()*static_cast<size_t>(state.range(3))/100;
+    for (size_t i=0;i<nofSeeds;i++) warmStart.paretoPoints.push_back(front[i*front.size()/std::max(nofSeeds,size_t(1))]);
+    warmStart.trustParetoPoints = state.range(4)!=0;
+    EnumerationOptions options;
+    options.warmStart = &warmStart;
+    runEnumerationBenchmark(state,shape,nofDimensions,nofPoints,range,std::chrono::nanoseconds(0),options);
+}
+
+void warmStartArguments(benchmark::internal::Benchmark *benchmark) {
+    benchmark->ArgNames({"shape","dims","points","known_percent","trusted"});
+    const long long sizes[][2] = {{2,1000},{3,1000},{4,1000},{6,300}};
+    for (auto const &size : sizes) {
+        benchmark->Args({LINEAR,size[0],size[1],0,0});
+        for (long long knownPercent : {50,100}) {
+            for (long long trusted : {0,1}) benchmark->Args({LINEAR,size[0],size[1],knownPercent,trusted});
+        }
+    }
+}
+
+BENCHMARK(BM_WarmStart)->Apply(warmStartArguments)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+//=================================================================================
+// Benchmarks for distributed enumerations, with the workers simulated one after
+// the other. Arguments: shape, dimensions, number of points, the number of
+// workers, and the maximal number of co-Pareto elements per work unit. Every
+// worker holds one work unit, and the oldest one is finished first, with at most
+// 100 calls to the feasibility function. The regions
+// of the work units overlap, so "calls_per_point" grows with the number of
+// workers. "wire_bytes" counts the encoded work units and results.
+//=================================================================================
+void BM_DistributedEnumeration(benchmark::State &state) {
+    const size_t nofDimensions = static_cast<size_t>(state.range(1));
+    const size_t nofWorkers = static_cast<size_t>(state.range(3));
+    const size_t workUnitSize = static_cast<size_t>(state.range(4));
+    const int range = 1000000;
+    PointSet front = makeFront(static_cast<FrontShape>(state.range(0)),nofDimensions,static_cast<size_t>(state.range(2)),range,1);
+    FrontOracle oracle(front,std::chrono::nanoseconds(0));
+    std::vector<std::pair<int,int> > limits(nofDimensions,std::pair<int,int>(0,range));
+
+    size_t nofOracleCalls = 0;
+    size_t wireBytes = 0;
+    for (auto _ : state) {
+        nofOracleCalls = 0;
+        wireBytes = 0;
+        EnumerationCoordinator coordinator(limits);
+        std::deque<std::pair<size_t,std::string> > openWorkUnits;
+        while (!coordinator.isFinished()) {
+            size_t workUnitId;
+            EnumerationState workUnit;
+            while ((openWorkUnits.size()<nofWorkers) && coordinator.getWorkUnit(workUnitSize,workUnitId,workUnit)) {
+                openWorkUnits.push_back(std::make_pair(workUnitId,encodeEnumerationState(workUnit)));
+                wireBytes += openWorkUnits.back().second.size();
+            }
+            decodeEnumerationState(openWorkUnits.front().second,workUnit);
+            EnumerationState result;
+            EnumerationStats stats;
+            EnumerationOptions options;
+            options.stats = &stats;
+            options.oracleCallBudget = 100;
+            enumerateWorkUnit(oracle,workUnit,result,options);
+            nofOracleCalls += stats.nofOracleCalls;
+            std::string encodedResult = encodeEnumerationState(result);
+            wireBytes += encodedResult.size();
+            decodeEnumerationState(encodedResult,result);
+            coordinator.addResult(openWorkUnits.front().first,result);
+            openWorkUnits.pop_front();
+        }
+        if (coordinator.getParetoFront().size()!=front.size()) {
+            state.SkipWithError("The enumerated front has the wrong size.");
+            return;
+        }
+    }
+    state.counters["pareto_points"] = static_cast<double>(front.size());
+    state.counters["oracle_calls"] = static_cast<double>(nofOracleCalls);
+    state.counters["calls_per_point"] = static_cast<double>(nofOracleCalls)/std::max(front.size(),size_t(1));
+    state.counters["wire_bytes"] = benchmark::Counter(static_cast<double>(wireBytes),benchmark::Counter::kDefaults,benchmark::Counter::OneK::kIs1024);
+}
+
+void distributedArguments(benchmark::internal::Benchmark *benchmark) {
+    benchmark->ArgNames({"shape","dims","points","workers","unit_size"});
+    for (long long nofWorkers : {1,4,16}) {
+        for (long long workUnitSize : {1,16}) {
+            benchmark->Args({LINEAR,3,1000,nofWorkers,workUnitSize});
+            benchmark->Args({LINEAR,4,300,nofWorkers,workUnitSize});
+        }
+    }
+}
+
+BENCHMARK(BM_DistributedEnumeration)->Apply(distributedArguments)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+//=================================================================================
+// Benchmarks for oracle caches. Arguments: shape, dimensions, number of points,
+// the capacity of the cache in percent of the calls of a single run (0 for no
+// cache), and the CacheEviction value. Runs are started from scratch with call
+// budgets of 64, 128, 256, ... until one of them finishes, so every run repeats
+// the calls of the previous one. "oracle_calls" sums up the calls of all runs.
+//=================================================================================
+void BM_OracleCache(benchmark::State &state) {
+    const size_t nofDimensions = static_cast<size_t>(state.range(1));
+    const int range = 1000000;
+    PointSet front = makeFront(static_cast<FrontShape>(state.range(0)),nofDimensions,static_cast<size_t>(state.range(2)),range,1);
+    FrontOracle oracle(front,std::chrono::nanoseconds(0));
+    std::vector<std::pair<int,int> > limits(nofDimensions,std::pair<int,int>(0,range));
+
+    EnumerationStats stats;
+    EnumerationState finalState;
+    EnumerationOptions options;
+    options.stats = &stats;
+    options.finalState = &finalState;
+    PointSet result;
+    enumerateParetoFront(oracle,limits,result,options);
+    const size_t capacity = stats.nofOracleCalls*static_cast<size_t>(state.range(3))/100;
+
+    size_t nofOracleCalls = 0;
+    size_t nofCacheHits = 0;
+    for (auto _ : state) {
+        std::unique_ptr<OracleCache> cache;
+        if (capacity>0) cache.reset(new OracleCache(nofDimensions,capacity,static_cast<CacheEviction>(state.range(4))));
+        options.oracleCache = cache.get();
+        nofOracleCalls = 0;
+        nofCacheHits = 0;
+        for (options.oracleCallBudget=64;;options.oracleCallBudget*=2) {
+            enumerateParetoFront(oracle,limits,result,options);
+            nofOracleCalls += stats.nofOracleCalls;
+            nofCacheHits += stats.nofOracleCacheHits;
+            if (finalState.coParetoElements.empty()) break;
+        }
+        if (result.size()!=front.size()) {
+            state.SkipWithError("The enumerated front has the wrong size.");
+            return;
+        }
+    }
+    state.counters["pareto_points"] = static_cast<double>(front.size());
+    state.counters["oracle_calls"] = static_cast<double>(nofOracleCalls);
+    state.counters["calls_per_point"] = static_cast<double>(nofOracleCalls)/std::max(front.size(),size_t(1));
+    state.counters["hit_rate"] = static_cast<double>(nofCacheHits)/std::max(nofOracleCalls+nofCacheHits,size_t(1));
+}
+
+void oracleCacheArguments(benchmark::internal::Benchmark *benchmark) {
+    benchmark->ArgNames({"shape","dims","points","capacity_percent","eviction"});
+    const long long sizes[][2] = {{2,1000},{3,1000},{4,300}};
+    for (auto const &size : sizes) {
+        benchmark->Args({LINEAR,size[0],size[1],0,EVICT_NOTHING});
+        for (long long capacityPercent : {25,100}) {
+            for (long long eviction : {EVICT_NOTHING,EVICT_CLOCK}) benchmark->Args({LINEAR,size[0],size[1],capacityPercent,eviction});
+        }
+    }
+}
+
+BENCHMARK(BM_OracleCache)->Apply(oracleCacheArguments)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+//=================================================================================
+// Benchmarks for asynchronous feasibility functions that simulate a remote
+// service: a call returns at once, and its result is ready after a fixed round
+// trip time. Arguments: dimensions, number of points, round trip time in
+// microseconds, the maximal number of pending calls, and the search arity.
+//=================================================================================
+void BM_AsyncOracle(benchmark::State &state) {
+    const size_t nofDimensions = static_cast<size_t>(state.range(0));
+    const int range = 1000000;
+    PointSet front = makeFront(LINEAR,nofDimensions,static_cast<size_t>(state.range(1)),range,1);
+    FrontOracle oracle(front,std::chrono::nanoseconds(0));
+    std::vector<std::pair<int,int> > limits(nofDimensions,std::pair<int,int>(0,range));
+    const std::chrono::microseconds roundTripTime(state.range(2));
+    auto asyncOracle = [&oracle,roundTripTime] (const std::vector<int> &point) {
+        std::chrono::steady_clock::time_point ready = std::chrono::steady_clock::now()+roundTripTime;
+        bool result = oracle(point);
+        return std::async(std::launch::async,[ready,result] () {
+            std::this_thread::sleep_until(ready);
+            return result;
+        });
+    };
+
+    EnumerationStats stats;
+    EnumerationOptions options;
+    options.stats = &stats;
+    options.maxBatchSize = static_cast<size_t>(state.range(3));
+    options.searchArity = static_cast<unsigned int>(state.range(4));
+    for (auto _ : state) {
+        PointSet result;
+        enumerateParetoFront(asyncOracle,limits,result,options);
+        if (result.size()!=front.size()) {
+            state.SkipWithError("The enumerated front has the wrong size.");
+            return;
+        }
+    }
+    state.counters["pareto_points"] = static_cast<double>(front.size());
+    state.counters["oracle_calls"] = static_cast<double>(stats.nofOracleCalls);
+    state.counters["calls_per_point"] = static_cast<double>(stats.nofOracleCalls)/std::max(front.size(),size_t(1));
+}
+
+void asyncOracleArguments(benchmark::internal::Benchmark *benchmark) {
+    benchmark->ArgNames({"dims","points","round_trip_us","pending","arity"});
+    for (long long nofPendingCalls : {1,4,16,64}) {
+        benchmark->Args({3,100,200,nofPendingCalls,1});
+        if (nofPendingCalls>1) benchmark->Args({3,100,200,nofPendingCalls,nofPendingCalls});
+    }
+}
+
+BENCHMARK(BM_AsyncOracle)->Apply(asyncOracleArguments)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+//=================================================================================
+// Benchmarks for runs with a memory limit. Arguments: dimensions, number of
+// points, and the memory limit in percent of the largest memory use of a run
+// without a limit (0 for no limit).
+//=================================================================================
+void BM_MemoryLimit(benchmark::State &state) {
+    const size_t nofDimensions = static_cast<size_t>(state.range(0));
+    const int range = 1000000;
+    PointSet front = makeFront(LINEAR,nofDimensions,static_cast<size_t>(state.range(1)),range,1);
+    FrontOracle oracle(front,std::chrono::nanoseconds(0));
+    std::vector<std::pair<int,int> > limits(nofDimensions,std::pair<int,int>(0,range));
+
+    EnumerationStats stats;
+    EnumerationOptions options;
+    options.stats = &stats;
+    PointSet result;
+    enumerateParetoFront(oracle,limits,result,options);
+    if (state.range(2)>0) options.memoryLimit = stats.maxMemoryUsage*static_cast<size_t>(state.range(2))/100;
+
+    for (auto _ : state) {
+        enumerateParetoFront(oracle,limits,result,options);
+        if (result.size()!=front.size()) {
+            state.SkipWithError("The enumerated front has the wrong size.");
+            return;
+        }
+    }
+    state.counters["pareto_points"] = static_cast<double>(front.size());
+    state.counters["oracle_calls"] = static_cast<double>(stats.nofOracleCalls);
+    state.counters["max_memory_kb"] = static_cast<double>(stats.maxMemoryUsage)/1024;
+    state.counters["spilled_elements"] = static_cast<double>(stats.nofSpilledCoParetoElements);
+    state.counters["spilled_negatives"] = static_cast<double>(stats.nofSpilledNegativePoints);
+}
+
+void memoryLimitArguments(benchmark::internal::Benchmark *benchmark) {
+    benchmark->ArgNames({"dims","points","limit_percent"});
+    const long long sizes[][2] = {{4,300},{5,100}};
+    for (auto const &size : sizes) {
+        for (long long limitPercent : {0,50,25,10}) benchmark->Args({size[0],size[1],limitPercent});
+    }
+}
+
+BENCHMARK(BM_MemoryLimit)->Apply(memoryLimitArguments)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+//=================================================================================
+// Benchmarks for approximations of the Pareto front. Arguments: dimensions,
+// number of points, and the tolerance in every dimension in per mille of the
+// range (0 for an exact run). "refine_calls" are the calls of an exact run that
+// continues from the refined final state of the approximation.
+//=================================================================================
+void BM_Approximation(benchmark::State &state) {
+    const size_t nofDimensions = static_cast<size_t>(state.range(0));
+    const int range = 1000000;
+    PointSet front = makeFront(LINEAR,nofDimensions,static_cast<size_t>(state.range(1)),range,1);
+    FrontOracle oracle(front,std::chrono::nanoseconds(0));
+    std::vector<std::pair<int,int> > limits(nofDimensions,std::pair<int,int>(0,range));
+
+    EnumerationStats stats;
+    EnumerationState approximateState;
+    EnumerationOptions options;
+    options.stats = &stats;
+    options.finalState = &approximateState;
+    if (state.range(2)>0) options.approximationTolerance.assign(nofDimensions,static_cast<int>(range/1000*state.range(2)));
+    PointSet result;
+    for (auto _ : state) {
+        enumerateParetoFront(oracle,limits,result,options);
+    }
+    const size_t nofApproximationCalls = stats.nofOracleCalls;
+
+    EnumerationState exactState;
+    refineEnumerationState(approximateState,exactState);
+    EnumerationOptions refineOptions;
+    refineOptions.stats = &stats;
+    refineOptions.initialState = &exactState;
+    PointSet refinedFront;
+    enumerateParetoFront(oracle,limits,refinedFront,refineOptions);
+    if (refinedFront.size()!=front.size()) {
+        state.SkipWithError("The refined front has the wrong size.");
+        return;
+    }
+    state.counters["pareto_points"] = static_cast<double>(front.size());
+    state.counters["found_points"] = static_cast<double>(result.size());
+    state.counters["oracle_calls"] = static_cast<double>(nofApproximationCalls);
+    state.counters["refine_calls"] = static_cast<double>(stats.nofOracleCalls);
+}
+
+void approximationArguments(benchmark::internal::Benchmark *benchmark) {
+    benchmark->ArgNames({"dims","points","tolerance_permille"});
+    const long long sizes[][2] = {{2,1000},{3,1000},{4,300}};
+    for (auto const &size : sizes) {
+        for (long long tolerance : {0,1,10,50}) benchmark->Args({size[0],size[1],tolerance});
+    }
+}
+
+BENCHMARK(BM_Approximation)->Apply(approximationArguments)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+//=================================================================================
+// Benchmarks for stopping at a fraction of the hypervolume of the Pareto front.
+// Arguments: dimensions, number of points, the hypervolume target in percent, and
+// the CoParetoSelection value. With a target of 100, the run is complete and
+// only reports the bounds, and with 0, it does not keep track of them at all.
+// "front_fraction" is the share of the Pareto points found.
+//=================================================================================
+void BM_Hypervolume(benchmark::State &state) {
+    const size_t nofDimensions = static_cast<size_t>(state.range(0));
+    const int range = 1000000;
+    PointSet front = makeFront(LINEAR,nofDimensions,static_cast<size_t>(state.range(1)),range,1);
+    FrontOracle oracle(front,std::chrono::nanoseconds(0));
+    std::vector<std::pair<int,int> > limits(nofDimensions,std::pair<int,int>(0,range));
+
+    EnumerationStats stats;
+    EnumerationOptions options;
+    options.stats = &stats;
+    options.selection = static_cast<CoParetoSelection>(state.range(3));
+    HypervolumeBound lastBound = HypervolumeBound();
+    if (state.range(2)>0) options.hypervolumeProgress = [&lastBound](const HypervolumeBound &bound) { lastBound = bound; };
+    if ((state.range(2)>0) && (state.range(2)<100)) options.hypervolumeTarget = state.range(2)/100.0;
+    PointSet result;
+    for (auto _ : state) {
+        enumerateParetoFront(oracle,limits,result,options);
+    }
+    state.counters["oracle_calls"] = static_cast<double>(stats.nofOracleCalls);
+    state.counters["front_fraction"] = static_cast<double>(result.size())/front.size();
+    state.counters["quality"] = lastBound.quality();
+}
+
+void hypervolumeArguments(benchmark::internal::Benchmark *benchmark) {
+    benchmark->ArgNames({"dims","points","target_percent","selection"});
+    const long long sizes[][2] = {{2,1000},{3,1000},{4,300}};
+    for (auto const &size : sizes) {
+        for (long long target : {0,100,99,90}) {
+            for (long long selection : {SELECT_IN_INDEX_ORDER,SELECT_LARGEST_BOX_FIRST,SELECT_LARGEST_GAP_FIRST}) {
+                if ((target==0) && (selection==SELECT_LARGEST_GAP_FIRST)) continue;
+                benchmark->Args({size[0],size[1],target,selection});
+            }
+        }
+    }
+}
+
+BENCHMARK(BM_Hypervolume)->Apply(hypervolumeArguments)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+//=================================================================================
+// Benchmarks for cleanParetoFront. Arguments: dimensions, number of points, and
+// whether the points are uniform in a box (0, few maximal points) or close to a
+// hyperplane (1, many maximal points).
+//=================================================================================
+PointSet makeCleaningInput(size_t nofDimensions, size_t nofPoints, bool nearHyperplane) {
+    std::mt19937 rng(1);
+    const int range = 100000;
+    PointSet points(nofDimensions);
+    std::vector<int> point(nofDimensions);
+    std::vector<double> weights(nofDimensions);
+    std::uniform_int_distribution<int> coordinate(0,range);
+    std::uniform_int_distribution<int> noise(0,range/1000);
+    for (size_t i=0;i<nofPoints;i++) {
+        if (nearHyperplane) {
+            drawFromSimplex(rng,weights);
+            for (size_t d=0;d<nofDimensions;d++) point[d] = static_cast<int>(weights[d]*range)+noise(rng);
+        } else {
+            for (size_t d=0;d<nofDimensions;d++) point[d] = coordinate(rng);
+        }
+        points.push_back(point);
+    }
+    return points;
+}
+
+/**
+ * @brief The all-pairs check that cleanParetoFront used originally, as a baseline
+ */
+PointSet allPairsCleanParetoFront(const PointSet &input) {
+    const size_t nofDimensions = input.dimensions();
+    PointSet cleanedElements(nofDimensions);
+    for (size_t i=0;i<input.size();i++) {
+        bool foundSmaller = false;
+        for (size_t j=0;(j<input.size()) && !foundSmaller;j++) {
+            bool allLeq = true;
+            bool anySmaller = false;
+            for (size_t d=0;(d<nofDimensions) && allLeq;d++) {
+                allLeq = input[i][d]<=input[j][d];
+                anySmaller |= input[i][d]<input[j][d];
+            }
+            foundSmaller = allLeq && anySmaller;
+        }
+        if (!foundSmaller) cleanedElements.push_back(input[i]);
+    }
+    return cleanedElements;
+}
+
+template<int variant> void BM_CleanParetoFront(benchmark::State &state) {
+    PointSet input = makeCleaningInput(static_cast<size_t>(state.range(0)),static_cast<size_t>(state.range(1)),state.range(2)!=0);
+    const unsigned int nofThreads = std::max(std::thread::hardware_concurrency(),2u);
+    size_t nofMaximalPoints = 0;
+    for (auto _ : state) {
+        PointSet result = (variant==0)?allPairsCleanParetoFront(input):((variant==1)?cleanParetoFront(input):cleanParetoFront(input,nofThreads));
+        nofMaximalPoints = result.size();
+        benchmark::DoNotOptimize(result);
+    }
+    state.counters["maximal_points"] = static_cast<double>(nofMaximalPoints);
+}
+
+void cleaningArguments(benchmark::internal::Benchmark *benchmark, long long maxNofPoints) {
+    benchmark->ArgNames({"dims","points","hyperplane"});
+    for (long long nofDimensions : {2,3,4,6,10}) {
+        for (long long nofPoints=1000;nofPoints<=maxNofPoints;nofPoints*=10) {
+            for (long long nearHyperplane : {0,1}) benchmark->Args({nofDimensions,nofPoints,nearHyperplane});
+        }
+    }
+}
+
+BENCHMARK_TEMPLATE(BM_CleanParetoFront,0)->Name("BM_CleanParetoFrontAllPairs")->Apply([](benchmark::internal::Benchmark *b) { cleaningArguments(b,10000); })->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_CleanParetoFront,1)->Name("BM_CleanParetoFront")->Apply([](benchmark::internal::Benchmark *b) { cleaningArguments(b,100000); })->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_CleanParetoFront,2)->Name("BM_CleanParetoFrontParallel")->Apply([](benchmark::internal::Benchmark *b) { cleaningArguments(b,100000); })->Unit(benchmark::kMillisecond)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -1,4 +1,27 @@
 #include "pareto_enumerator.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <cstdio>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
 
 /*
  * This is
@@ -39,166 +62,1378 @@
 
 namespace paretoenumerator {
 
-    inline bool vectorOfIntIsSmaller(const std::vector<int>& a, const std::vector<int> &b) {
-        const size_t size = a.size();
-        for (size_t i = 0;i<size;i++) {
-            if (b[i]<a[i]) return false;
-            if (b[i]!=a[i]) {
-                // We continue the outer loop now here as this is
-                // faster than storing whether a smaller
-                // element has been found in a flag.
-                for (i++;i<size;i++) {
-                    if (b[i]<a[i]) return false;
+namespace detail {
+
+    //=============================================================================================================
+    // Kernels that compare a point against a block of up to 64 points. The points in a block are stored column by
+    // column, i.e., the first "blockCapacity" entries are the values of all points in the first dimension, etc. For N>0,
+    // the loops over the dimensions have a trip count of N that is known at compile time.
+    //=============================================================================================================
+
+    template<size_t N, bool geq> uint64_t blockKernelScalar(const int *block, const int *point, size_t _nofDimensions, uint64_t mask) {
+        const Dimensions<N> nofDimensions(_nofDimensions);
+        for (size_t d=0;(d<nofDimensions) && (mask!=0);d++) {
+            const int *column = block + d*blockCapacity;
+            const int value = point[d];
+            uint64_t thisMask = 0;
+            for (size_t i=0;i<blockCapacity;i++) {
+                thisMask |= uint64_t(geq?(column[i]>=value):(column[i]<=value)) << i;
+            }
+            mask &= thisMask;
+        }
+        return mask;
+    }
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define PARETO_ENUMERATOR_X86_KERNELS
+
+    // The kernels compute the mask of the points that violate the condition, as SSE2 and AVX2 only offer a
+    // "greater than" comparison.
+    template<size_t N, bool geq> __attribute__((target("sse2"))) uint64_t blockKernelSSE2(const int *block, const int *point, size_t _nofDimensions, uint64_t mask) {
+        const Dimensions<N> nofDimensions(_nofDimensions);
+        for (size_t d=0;(d<nofDimensions) && (mask!=0);d++) {
+            const int *column = block + d*blockCapacity;
+            const __m128i value = _mm_set1_epi32(point[d]);
+            uint64_t violations = 0;
+            for (size_t i=0;i<blockCapacity;i+=4) {
+                const __m128i data = _mm_loadu_si128(reinterpret_cast<const __m128i*>(column+i));
+                const __m128i violated = geq?_mm_cmpgt_epi32(value,data):_mm_cmpgt_epi32(data,value);
+                violations |= uint64_t(_mm_movemask_ps(_mm_castsi128_ps(violated))) << i;
+            }
+            mask &= ~violations;
+        }
+        return mask;
+    }
+
+    template<size_t N, bool geq> __attribute__((target("avx2"))) uint64_t blockKernelAVX2(const int *block, const int *point, size_t _nofDimensions, uint64_t mask) {
+        const Dimensions<N> nofDimensions(_nofDimensions);
+        for (size_t d=0;(d<nofDimensions) && (mask!=0);d++) {
+            const int *column = block + d*blockCapacity;
+            const __m256i value = _mm256_set1_epi32(point[d]);
+            uint64_t violations = 0;
+            for (size_t i=0;i<blockCapacity;i+=8) {
+                const __m256i data = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(column+i));
+                const __m256i violated = geq?_mm256_cmpgt_epi32(value,data):_mm256_cmpgt_epi32(data,value);
+                violations |= uint64_t(uint32_t(_mm256_movemask_ps(_mm256_castsi256_ps(violated)))) << i;
+            }
+            mask &= ~violations;
+        }
+        return mask;
+    }
+
+    template<size_t N, bool geq> __attribute__((target("avx512f"))) uint64_t blockKernelAVX512(const int *block, const int *point, size_t _nofDimensions, uint64_t mask) {
+        const Dimensions<N> nofDimensions(_nofDimensions);
+        for (size_t d=0;(d<nofDimensions) && (mask!=0);d++) {
+            const int *column = block + d*blockCapacity;
+            const __m512i value = _mm512_set1_epi32(point[d]);
+            uint64_t matches = 0;
+            for (size_t i=0;i<blockCapacity;i+=16) {
+                const __m512i data = _mm512_loadu_si512(column+i);
+                matches |= uint64_t(geq?_mm512_cmpge_epi32_mask(data,value):_mm512_cmple_epi32_mask(data,value)) << i;
+            }
+            mask &= matches;
+        }
+        return mask;
+    }
+
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define PARETO_ENUMERATOR_NEON_KERNELS
+
+    template<size_t N, bool geq> uint64_t blockKernelNEON(const int *block, const int *point, size_t _nofDimensions, uint64_t mask) {
+        const Dimensions<N> nofDimensions(_nofDimensions);
+        const uint32_t laneBitsData[4] = {1,2,4,8};
+        const uint32x4_t laneBits = vld1q_u32(laneBitsData);
+        for (size_t d=0;(d<nofDimensions) && (mask!=0);d++) {
+            const int *column = block + d*blockCapacity;
+            const int32x4_t value = vdupq_n_s32(point[d]);
+            uint64_t matches = 0;
+            for (size_t i=0;i<blockCapacity;i+=4) {
+                const int32x4_t data = vld1q_s32(column+i);
+                const uint32x4_t matched = geq?vcgeq_s32(data,value):vcleq_s32(data,value);
+                matches |= uint64_t(vaddvq_u32(vandq_u32(matched,laneBits))) << i;
+            }
+            mask &= matches;
+        }
+        return mask;
+    }
+
+#endif
+
+    //=============================================================================================================
+    // Kernels for packed coordinates. Bit-sliced columns only need one AND per dimension. For 8 and 16 bits, the
+    // portable kernels compare the values of all slots in a 64-bit word at once (SWAR), and the SSE2 and AVX2 kernels
+    // use saturating subtraction, which is zero exactly if the first value is not greater than the second one.
+    //=============================================================================================================
+
+    template<size_t N, bool geq> uint64_t bitSlicedBlockKernel(const uint64_t *block, const int *point, size_t _nofDimensions, uint64_t mask) {
+        const Dimensions<N> nofDimensions(_nofDimensions);
+        for (size_t d=0;d<nofDimensions;d++) {
+            // A value of 0 in the point matches all slots for "geq", and a value of 1 for "leq"
+            if (geq && (point[d]!=0)) mask &= block[d];
+            if (!geq && (point[d]==0)) mask &= ~block[d];
+        }
+        return mask;
+    }
+
+    /**
+     * @brief Moves the highest bit of every slot of a word to bit "i" for the i-th slot. As the highest bits are at least
+     * "bitsPerCoordinate" bits apart, the multiplication adds no two bits at the same position.
+     */
+    template<unsigned int bitsPerCoordinate> uint64_t gatherHighestBits(uint64_t highestBits);
+    template<> inline uint64_t gatherHighestBits<8>(uint64_t highestBits) {
+        return ((highestBits >> 7)*0x0102040810204080ULL) >> 56;
+    }
+    template<> inline uint64_t gatherHighestBits<16>(uint64_t highestBits) {
+        return (((highestBits >> 15)*0x0001000200040008ULL) >> 48) & 0xF;
+    }
+
+    template<size_t N, unsigned int bitsPerCoordinate, bool geq> uint64_t packedBlockKernelSWAR(const uint64_t *block, const int *point, size_t _nofDimensions, uint64_t mask) {
+        const Dimensions<N> nofDimensions(_nofDimensions);
+        const uint64_t lowestBits = ~uint64_t(0)/((uint64_t(1) << bitsPerCoordinate)-1);
+        const uint64_t highestBits = lowestBits << (bitsPerCoordinate-1);
+        const size_t slotsPerWord = 64/bitsPerCoordinate;
+        for (size_t d=0;(d<nofDimensions) && (mask!=0);d++) {
+            const uint64_t *column = block + d*bitsPerCoordinate;
+            const uint64_t value = uint64_t(point[d])*lowestBits;
+            uint64_t matches = 0;
+            for (size_t w=0;w<bitsPerCoordinate;w++) {
+                // Compute "a>=b" for all slots. Setting the highest bits of "a" and clearing them in "b" keeps the
+                // subtraction of the lower bits from borrowing across slots. The highest bits are then compared separately.
+                const uint64_t a = geq?column[w]:value;
+                const uint64_t b = geq?value:column[w];
+                const uint64_t lowerBitsGeq = (a | highestBits) - (b & ~highestBits);
+                const uint64_t slotGeq = ((a & ~b) | (~(a ^ b) & lowerBitsGeq)) & highestBits;
+                matches |= gatherHighestBits<bitsPerCoordinate>(slotGeq) << (w*slotsPerWord);
+            }
+            mask &= matches;
+        }
+        return mask;
+    }
+
+#if defined(PARETO_ENUMERATOR_X86_KERNELS)
+
+    template<size_t N, unsigned int bitsPerCoordinate, bool geq> __attribute__((target("sse2"))) uint64_t packedBlockKernelSSE2(const uint64_t *block, const int *point, size_t _nofDimensions, uint64_t mask) {
+        const Dimensions<N> nofDimensions(_nofDimensions);
+        const __m128i zero = _mm_setzero_si128();
+        for (size_t d=0;(d<nofDimensions) && (mask!=0);d++) {
+            const __m128i *column = reinterpret_cast<const __m128i*>(block + d*bitsPerCoordinate);
+            const __m128i value = (bitsPerCoordinate==8)?_mm_set1_epi8(char(point[d])):_mm_set1_epi16(short(point[d]));
+            uint64_t matches = 0;
+            for (size_t i=0;i<blockCapacity;i+=16) {
+                __m128i matched;
+                if (bitsPerCoordinate==8) {
+                    const __m128i data = _mm_loadu_si128(column+i/16);
+                    matched = _mm_cmpeq_epi8(geq?_mm_subs_epu8(value,data):_mm_subs_epu8(data,value),zero);
+                } else {
+                    const __m128i data0 = _mm_loadu_si128(column+i/8);
+                    const __m128i data1 = _mm_loadu_si128(column+i/8+1);
+                    const __m128i matched0 = _mm_cmpeq_epi16(geq?_mm_subs_epu16(value,data0):_mm_subs_epu16(data0,value),zero);
+                    const __m128i matched1 = _mm_cmpeq_epi16(geq?_mm_subs_epu16(value,data1):_mm_subs_epu16(data1,value),zero);
+                    matched = _mm_packs_epi16(matched0,matched1);
                 }
-                return true;
+                matches |= uint64_t(uint32_t(_mm_movemask_epi8(matched))) << i;
             }
+            mask &= matches;
         }
-        return false;
+        return mask;
     }
 
-    bool vectorOfIntIsLeq(const std::vector<int>& a, const std::vector<int> &b) {
-        const size_t size = a.size();
-        for (size_t i = 0;i<size;i++) {
-            if (b[i]<a[i]) return false;
+    template<size_t N, unsigned int bitsPerCoordinate, bool geq> __attribute__((target("avx2"))) uint64_t packedBlockKernelAVX2(const uint64_t *block, const int *point, size_t _nofDimensions, uint64_t mask) {
+        const Dimensions<N> nofDimensions(_nofDimensions);
+        const __m256i zero = _mm256_setzero_si256();
+        for (size_t d=0;(d<nofDimensions) && (mask!=0);d++) {
+            const __m256i *column = reinterpret_cast<const __m256i*>(block + d*bitsPerCoordinate);
+            const __m256i value = (bitsPerCoordinate==8)?_mm256_set1_epi8(char(point[d])):_mm256_set1_epi16(short(point[d]));
+            uint64_t matches = 0;
+            for (size_t i=0;i<blockCapacity;i+=32) {
+                __m256i matched;
+                if (bitsPerCoordinate==8) {
+                    const __m256i data = _mm256_loadu_si256(column+i/32);
+                    matched = _mm256_cmpeq_epi8(geq?_mm256_subs_epu8(value,data):_mm256_subs_epu8(data,value),zero);
+                } else {
+                    const __m256i data0 = _mm256_loadu_si256(column+i/16);
+                    const __m256i data1 = _mm256_loadu_si256(column+i/16+1);
+                    const __m256i matched0 = _mm256_cmpeq_epi16(geq?_mm256_subs_epu16(value,data0):_mm256_subs_epu16(data0,value),zero);
+                    const __m256i matched1 = _mm256_cmpeq_epi16(geq?_mm256_subs_epu16(value,data1):_mm256_subs_epu16(data1,value),zero);
+                    // Packing works within 128-bit lanes, so the middle quarters have to be swapped afterwards
+                    matched = _mm256_permute4x64_epi64(_mm256_packs_epi16(matched0,matched1),0xD8);
+                }
+                matches |= uint64_t(uint32_t(_mm256_movemask_epi8(matched))) << i;
+            }
+            mask &= matches;
+        }
+        return mask;
+    }
+
+#endif
+
+    template<size_t N, unsigned int bitsPerCoordinate> PackedBlockKernels selectPackedBlockKernels() {
+#if defined(PARETO_ENUMERATOR_X86_KERNELS)
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) return PackedBlockKernels{packedBlockKernelAVX2<N,bitsPerCoordinate,true>,packedBlockKernelAVX2<N,bitsPerCoordinate,false>};
+        if (__builtin_cpu_supports("sse2")) return PackedBlockKernels{packedBlockKernelSSE2<N,bitsPerCoordinate,true>,packedBlockKernelSSE2<N,bitsPerCoordinate,false>};
+#endif
+        return PackedBlockKernels{packedBlockKernelSWAR<N,bitsPerCoordinate,true>,packedBlockKernelSWAR<N,bitsPerCoordinate,false>};
+    }
+
+    template<size_t N> const PackedBlockKernels &getPackedBlockKernels(unsigned int bitsPerCoordinate) {
+        static const PackedBlockKernels bitSlicedKernels = {bitSlicedBlockKernel<N,true>,bitSlicedBlockKernel<N,false>};
+        static const PackedBlockKernels kernels8 = selectPackedBlockKernels<N,8>();
+        static const PackedBlockKernels kernels16 = selectPackedBlockKernels<N,16>();
+        switch (bitsPerCoordinate) {
+        case 1: return bitSlicedKernels;
+        case 8: return kernels8;
+        case 16: return kernels16;
+        default: throw "Error: Unsupported number of bits per packed coordinate.";
+        }
+    }
+
+    template<size_t N> const BlockKernels &getBlockKernels() {
+        static const BlockKernels kernels = []() -> BlockKernels {
+#if defined(PARETO_ENUMERATOR_X86_KERNELS)
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx512f")) return BlockKernels{blockKernelAVX512<N,true>,blockKernelAVX512<N,false>};
+            if (__builtin_cpu_supports("avx2")) return BlockKernels{blockKernelAVX2<N,true>,blockKernelAVX2<N,false>};
+            if (__builtin_cpu_supports("sse2")) return BlockKernels{blockKernelSSE2<N,true>,blockKernelSSE2<N,false>};
+#elif defined(PARETO_ENUMERATOR_NEON_KERNELS)
+            return BlockKernels{blockKernelNEON<N,true>,blockKernelNEON<N,false>};
+#endif
+            return BlockKernels{blockKernelScalar<N,true>,blockKernelScalar<N,false>};
+        }();
+        return kernels;
+    }
+
+    template<size_t N> std::vector<BlockKernels> getSupportedBlockKernels() {
+        std::vector<BlockKernels> kernels(1,BlockKernels{blockKernelScalar<N,true>,blockKernelScalar<N,false>});
+#if defined(PARETO_ENUMERATOR_X86_KERNELS)
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("sse2")) kernels.push_back(BlockKernels{blockKernelSSE2<N,true>,blockKernelSSE2<N,false>});
+        if (__builtin_cpu_supports("avx2")) kernels.push_back(BlockKernels{blockKernelAVX2<N,true>,blockKernelAVX2<N,false>});
+        if (__builtin_cpu_supports("avx512f")) kernels.push_back(BlockKernels{blockKernelAVX512<N,true>,blockKernelAVX512<N,false>});
+#elif defined(PARETO_ENUMERATOR_NEON_KERNELS)
+        kernels.push_back(BlockKernels{blockKernelNEON<N,true>,blockKernelNEON<N,false>});
+#endif
+        return kernels;
+    }
+
+    template<size_t N, unsigned int bitsPerCoordinate> std::vector<PackedBlockKernels> getSupportedPackedBlockKernels() {
+        std::vector<PackedBlockKernels> kernels(1,PackedBlockKernels{packedBlockKernelSWAR<N,bitsPerCoordinate,true>,packedBlockKernelSWAR<N,bitsPerCoordinate,false>});
+#if defined(PARETO_ENUMERATOR_X86_KERNELS)
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("sse2")) kernels.push_back(PackedBlockKernels{packedBlockKernelSSE2<N,bitsPerCoordinate,true>,packedBlockKernelSSE2<N,bitsPerCoordinate,false>});
+        if (__builtin_cpu_supports("avx2")) kernels.push_back(PackedBlockKernels{packedBlockKernelAVX2<N,bitsPerCoordinate,true>,packedBlockKernelAVX2<N,bitsPerCoordinate,false>});
+#endif
+        return kernels;
+    }
+
+    template<size_t N> std::vector<PackedBlockKernels> getSupportedPackedBlockKernels(unsigned int bitsPerCoordinate) {
+        switch (bitsPerCoordinate) {
+        case 1: return std::vector<PackedBlockKernels>(1,PackedBlockKernels{bitSlicedBlockKernel<N,true>,bitSlicedBlockKernel<N,false>});
+        case 8: return getSupportedPackedBlockKernels<N,8>();
+        case 16: return getSupportedPackedBlockKernels<N,16>();
+        default: throw "Error: Unsupported number of bits per packed coordinate.";
+        }
+    }
+
+    // The kernels for the numbers of dimensions of the enumerators in "runEnumerator"
+    template const BlockKernels &getBlockKernels<0>();
+    template const PackedBlockKernels &getPackedBlockKernels<0>(unsigned int);
+    template std::vector<BlockKernels> getSupportedBlockKernels<0>();
+    template std::vector<PackedBlockKernels> getSupportedPackedBlockKernels<0>(unsigned int);
+    template const BlockKernels &getBlockKernels<3>();
+    template const PackedBlockKernels &getPackedBlockKernels<3>(unsigned int);
+    template std::vector<BlockKernels> getSupportedBlockKernels<3>();
+    template std::vector<PackedBlockKernels> getSupportedPackedBlockKernels<3>(unsigned int);
+    template const BlockKernels &getBlockKernels<4>();
+    template const PackedBlockKernels &getPackedBlockKernels<4>(unsigned int);
+    template std::vector<BlockKernels> getSupportedBlockKernels<4>();
+    template std::vector<PackedBlockKernels> getSupportedPackedBlockKernels<4>(unsigned int);
+    template const BlockKernels &getBlockKernels<5>();
+    template const PackedBlockKernels &getPackedBlockKernels<5>(unsigned int);
+    template std::vector<BlockKernels> getSupportedBlockKernels<5>();
+    template std::vector<PackedBlockKernels> getSupportedPackedBlockKernels<5>(unsigned int);
+    template const BlockKernels &getBlockKernels<6>();
+    template const PackedBlockKernels &getPackedBlockKernels<6>(unsigned int);
+    template std::vector<BlockKernels> getSupportedBlockKernels<6>();
+    template std::vector<PackedBlockKernels> getSupportedPackedBlockKernels<6>(unsigned int);
+
+    /**
+     * @brief Marks the points that are not smaller than any other point for two or three dimensions. The points are
+     * processed in descending lexicographic order, so that every point that is larger than the current one has been
+     * processed before. Then, only the projection of the processed points onto the last dimensions is needed to find out
+     * whether the current point is smaller than of one of them. For two dimensions, this is the largest value in the
+     * last dimension. For three dimensions, this is the staircase of maximal pairs of values in the last two dimensions.
+     * Runs in O(n log n) time.
+     */
+    void markMaximalPointsBySweep(const PointSet &input, std::vector<char> &isMaximal) {
+        const size_t nofDimensions = input.dimensions();
+        std::vector<size_t> order(input.size());
+        for (size_t i=0;i<input.size();i++) order[i] = i;
+        std::sort(order.begin(),order.end(),[&input,nofDimensions](size_t a, size_t b) {
+            return std::lexicographical_compare(input[b],input[b]+nofDimensions,input[a],input[a]+nofDimensions);
+        });
+
+        int largestValue = std::numeric_limits<int>::min(); // For two dimensions
+        std::map<int,int> staircase; // For three dimensions. The values in the last dimension decrease along the map.
+        bool processedAnyPoint = false;
+        size_t runStart = 0;
+        while (runStart<order.size()) {
+            // Equal points are adjacent in the order and get the same result
+            const int *point = input[order[runStart]];
+            size_t runEnd = runStart+1;
+            while ((runEnd<order.size()) && std::equal(point,point+nofDimensions,input[order[runEnd]])) runEnd++;
+
+            bool maximal;
+            if (nofDimensions==2) {
+                maximal = !processedAnyPoint || (largestValue<point[1]);
+                largestValue = std::max(largestValue,point[1]);
+            } else {
+                std::map<int,int>::iterator it = staircase.lower_bound(point[1]);
+                maximal = (it==staircase.end()) || (it->second<point[2]);
+                if (maximal) {
+                    // Remove the steps that the new point covers
+                    it = staircase.upper_bound(point[1]);
+                    while ((it!=staircase.begin()) && (std::prev(it)->second<=point[2])) {
+                        staircase.erase(std::prev(it));
+                    }
+                    staircase[point[1]] = point[2];
+                }
+            }
+            for (size_t i=runStart;i<runEnd;i++) isMaximal[order[i]] = maximal;
+            processedAnyPoint = true;
+            runStart = runEnd;
+        }
+    }
+
+    /**
+     * @brief Marks the points that are not smaller than any other point for any number of dimensions. Points are
+     * processed in descending order of their coordinate sums, so that all points that are larger than the current one
+     * have been processed before. Every smaller point is smaller than some maximal point, so it suffices to compare
+     * against the maximal points found so far, which are kept in blocks for the block kernels (sort-filter-skyline).
+     */
+    void markMaximalPointsBySortFilter(const PointSet &input, std::vector<char> &isMaximal) {
+        const size_t nofDimensions = input.dimensions();
+        const BlockKernel geqKernel = getBlockKernels<0>().geq;
+
+        std::vector<std::pair<int64_t,size_t> > order(input.size());
+        for (size_t i=0;i<input.size();i++) {
+            int64_t sum = 0;
+            for (size_t d=0;d<nofDimensions;d++) sum += input[i][d];
+            order[i] = std::pair<int64_t,size_t>(-sum,i);
+        }
+        std::sort(order.begin(),order.end());
+
+        std::vector<int> window;
+        std::vector<size_t> windowPoints;
+        for (size_t i=0;i<order.size();i++) {
+            const int *point = input[order[i].second];
+            bool foundSmaller = false;
+            for (size_t b=0;(b*blockCapacity<windowPoints.size()) && !foundSmaller;b++) {
+                uint64_t mask = geqKernel(&(window[b*blockCapacity*nofDimensions]),point,nofDimensions,maskOfFirstElements(windowPoints.size()-b*blockCapacity));
+                // The kernel also finds points that are equal to the current one
+                while ((mask!=0) && !foundSmaller) {
+                    foundSmaller = pointIsSmaller(point,input[windowPoints[b*blockCapacity+indexOfLowestBit(mask)]],nofDimensions);
+                    mask &= mask-1;
+                }
+            }
+            if (!foundSmaller) {
+                isMaximal[order[i].second] = true;
+                if ((windowPoints.size() % blockCapacity)==0) window.resize(window.size()+blockCapacity*nofDimensions);
+                int *block = &(window[(windowPoints.size()/blockCapacity)*blockCapacity*nofDimensions]);
+                for (size_t d=0;d<nofDimensions;d++) block[d*blockCapacity+(windowPoints.size() % blockCapacity)] = point[d];
+                windowPoints.push_back(order[i].second);
+            }
         }
-        return true;
     }
 
+    /**
+     * @brief Removes all dominating elements from a set of search space points
+     * @param input The initial set of points
+     * @param cleanedElements The set into which the cleaned set of points is written. Must be different from "input".
+     * The points keep their order from "input".
+     */
+    void cleanParetoFront(const PointSet &input, PointSet &cleanedElements) {
+        std::vector<char> isMaximal(input.size(),false);
+        if ((input.dimensions()==2) || (input.dimensions()==3)) {
+            markMaximalPointsBySweep(input,isMaximal);
+        } else {
+            markMaximalPointsBySortFilter(input,isMaximal);
+        }
+        cleanedElements.clear();
+        for (size_t i=0;i<input.size();i++) {
+            if (isMaximal[i]) cleanedElements.push_back(input[i]);
+        }
+    }
+
+} // End of namespace detail
+
     /**
      * @brief Removes all dominating elements from a set of search space points
      * @param input The initial set of points
      * @return The cleaned set of points
      */
+    PointSet cleanParetoFront(const PointSet &input) {
+        PointSet cleanedElements(input.dimensions());
+        detail::cleanParetoFront(input,cleanedElements);
+        return cleanedElements;
+    }
+
     std::list<std::vector<int> > cleanParetoFront(const std::list<std::vector<int> > &input) {
-        std::list<std::vector<int> > cleanedElements;
-        for (auto const &it : input) {
-            bool foundSmaller = false;
-            for (const auto &it2 : input) {
-                if (vectorOfIntIsSmaller(it,it2)) {
-                    foundSmaller = true;
-                    break;
+        if (input.empty()) return input;
+        return cleanParetoFront(PointSet(input.front().size(),input)).toList();
+    }
+
+
+
+    //=============================================================================================================
+    // State files. They start with a header of
+    //      8 bytes: "PFEState"
+    //      12 bytes: format version, number of dimensions and number of approximation tolerances, which is 0 for an
+    //                exact run (each as uint32_t)
+    //      2*nofDimensions*4 bytes: the limits (as int32_t)
+    //      nofApproximationTolerances*4 bytes: the approximation tolerances (as int32_t)
+    //      4*8 bytes: the number of Pareto points, co-Pareto elements, negative points and positive points (as uint64_t)
+    // that is followed by the coordinates of the points of the four sets (as int32_t), all in the byte order of the
+    // machine that wrote the file.
+    //=============================================================================================================
+    const char stateFileMagic[8] = {'P','F','E','S','t','a','t','e'};
+    const uint32_t stateFileVersion = 2;
+
+    void saveEnumerationState(const std::string &filename, const EnumerationState &state) {
+        const PointSet *sets[4] = {&state.paretoFront,&state.coParetoElements,&state.negativePoints,&state.positivePoints};
+        const uint32_t nofDimensions = state.limits.size();
+        const uint32_t nofApproximationTolerances = state.approximationTolerance.size();
+        for (auto set : sets) {
+            if (set->dimensions()!=nofDimensions) throw "Error: The sets of an enumeration state need to have the same dimension as its limits.";
+        }
+        if ((nofApproximationTolerances!=0) && (nofApproximationTolerances!=nofDimensions)) throw "Error: The approximation tolerance needs to have one value per dimension.";
+
+        // Write to a temporary file first, so that a crash while writing does not destroy an earlier state file
+        std::string temporaryFilename = filename+".tmp";
+        std::ofstream file(temporaryFilename.c_str(),std::ios::binary | std::ios::trunc);
+        file.write(stateFileMagic,sizeof(stateFileMagic));
+        file.write(reinterpret_cast<const char*>(&stateFileVersion),sizeof(stateFileVersion));
+        file.write(reinterpret_cast<const char*>(&nofDimensions),sizeof(nofDimensions));
+        file.write(reinterpret_cast<const char*>(&nofApproximationTolerances),sizeof(nofApproximationTolerances));
+        for (auto const &i : state.limits) {
+            int32_t limit[2] = {i.first,i.second};
+            file.write(reinterpret_cast<const char*>(limit),sizeof(limit));
+        }
+        for (int i : state.approximationTolerance) {
+            int32_t tolerance = i;
+            file.write(reinterpret_cast<const char*>(&tolerance),sizeof(tolerance));
+        }
+        for (auto set : sets) {
+            uint64_t nofPoints = set->size();
+            file.write(reinterpret_cast<const char*>(&nofPoints),sizeof(nofPoints));
+        }
+        for (auto set : sets) {
+            file.write(reinterpret_cast<const char*>(set->coordinates().data()),set->coordinates().size()*sizeof(int32_t));
+        }
+        file.close();
+        if (file.fail()) throw "Error: Could not write the enumeration state file.";
+        if (std::rename(temporaryFilename.c_str(),filename.c_str())!=0) throw "Error: Could not replace the enumeration state file.";
+    }
+
+namespace detail {
+
+    /**
+     * @brief Reads an enumeration state from the content of a state file
+     */
+    void parseEnumerationState(const char *data, size_t size, EnumerationState &state) {
+        const char *const end = data+size;
+        uint32_t header[3];
+        if ((size<sizeof(stateFileMagic)+sizeof(header)) || !std::equal(stateFileMagic,stateFileMagic+sizeof(stateFileMagic),data)) throw "Error: The enumeration state file has an invalid format.";
+        data += sizeof(stateFileMagic);
+        std::copy(data,data+sizeof(header),reinterpret_cast<char*>(header));
+        data += sizeof(header);
+        if (header[0]!=stateFileVersion) throw "Error: The enumeration state file has an unsupported format version.";
+        const size_t nofDimensions = header[1];
+        const size_t nofApproximationTolerances = header[2];
+        if ((nofApproximationTolerances!=0) && (nofApproximationTolerances!=nofDimensions)) throw "Error: The enumeration state file has an invalid format.";
+
+        uint64_t nofPoints[4];
+        if ((size_t)(end-data)<(nofDimensions*2+nofApproximationTolerances)*sizeof(int32_t)+sizeof(nofPoints)) throw "Error: The enumeration state file is truncated.";
+        state.limits.resize(nofDimensions);
+        for (size_t i=0;i<nofDimensions;i++) {
+            int32_t limit[2];
+            std::copy(data,data+sizeof(limit),reinterpret_cast<char*>(limit));
+            data += sizeof(limit);
+            state.limits[i] = std::pair<int,int>(limit[0],limit[1]);
+        }
+        state.approximationTolerance.resize(nofApproximationTolerances);
+        for (size_t i=0;i<nofApproximationTolerances;i++) {
+            int32_t tolerance;
+            std::copy(data,data+sizeof(tolerance),reinterpret_cast<char*>(&tolerance));
+            data += sizeof(tolerance);
+            state.approximationTolerance[i] = tolerance;
+        }
+        std::copy(data,data+sizeof(nofPoints),reinterpret_cast<char*>(nofPoints));
+        data += sizeof(nofPoints);
+
+        PointSet *sets[4] = {&state.paretoFront,&state.coParetoElements,&state.negativePoints,&state.positivePoints};
+        std::vector<int32_t> coordinates;
+        for (size_t i=0;i<4;i++) {
+            if ((nofDimensions>0) && (nofPoints[i]>(uint64_t)(end-data)/(nofDimensions*sizeof(int32_t)))) throw "Error: The enumeration state file is truncated.";
+            coordinates.resize(nofPoints[i]*nofDimensions);
+            std::copy(data,data+coordinates.size()*sizeof(int32_t),reinterpret_cast<char*>(coordinates.data()));
+            data += coordinates.size()*sizeof(int32_t);
+            PointSet(nofDimensions).swap(*sets[i]);
+            sets[i]->append(coordinates.data(),nofPoints[i]);
+        }
+    }
+
+} // End of namespace detail
+
+    bool loadEnumerationState(const std::string &filename, EnumerationState &state) {
+#if defined(__unix__) || defined(__APPLE__)
+        // Map the file into memory rather than reading it through a stream buffer
+        int fd = open(filename.c_str(),O_RDONLY);
+        if (fd<0) {
+            if (errno==ENOENT) return false;
+            throw "Error: Could not open the enumeration state file.";
+        }
+        struct stat fileInfo;
+        if (fstat(fd,&fileInfo)!=0) {
+            close(fd);
+            throw "Error: Could not open the enumeration state file.";
+        }
+        const size_t size = fileInfo.st_size;
+        if (size==0) {
+            close(fd);
+            throw "Error: The enumeration state file has an invalid format.";
+        }
+        void *mapping = mmap(NULL,size,PROT_READ,MAP_PRIVATE,fd,0);
+        close(fd);
+        if (mapping==MAP_FAILED) throw "Error: Could not map the enumeration state file into memory.";
+        try {
+            detail::parseEnumerationState(static_cast<const char*>(mapping),size,state);
+        } catch (...) {
+            munmap(mapping,size);
+            throw;
+        }
+        munmap(mapping,size);
+#else
+        std::ifstream file(filename.c_str(),std::ios::binary);
+        if (!file.is_open()) return false;
+        std::vector<char> data((std::istreambuf_iterator<char>(file)),std::istreambuf_iterator<char>());
+        if (file.bad()) throw "Error: Could not read the enumeration state file.";
+        detail::parseEnumerationState(data.data(),data.size(),state);
+#endif
+        return true;
+    }
+
+
+    //=============================================================================================================
+    // Encoded enumeration states. They consist of
+    //      4 bytes: "PFEW"
+    //      the format version, the number of dimensions, the limits, the number of approximation tolerances (0 for an
+    //      exact run) and the tolerances, and the number of Pareto points, co-Pareto elements, negative points and
+    //      positive points
+    // that are followed by the coordinates of the points of the four sets. All numbers are variable-length integers with
+    // 7 bits per byte, starting with the lowest bits, and the signed ones are zigzag-encoded. Every coordinate is stored
+    // as the difference to the same coordinate of the previous point of its set, or to the lower limit for the first point.
+    //=============================================================================================================
+    const char encodedStateMagic[4] = {'P','F','E','W'};
+    const uint64_t encodedStateVersion = 2;
+
+namespace detail {
+
+    void appendVarint(std::string &out, uint64_t value) {
+        while (value>=0x80) {
+            out.push_back(static_cast<char>((value & 0x7F) | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast<char>(value));
+    }
+
+    void appendSignedVarint(std::string &out, int64_t value) {
+        appendVarint(out,(static_cast<uint64_t>(value) << 1) ^ ((value<0)?~uint64_t(0):uint64_t(0)));
+    }
+
+    /**
+     * @brief Reads the variable-length integers of an encoded enumeration state one after the other
+     */
+    class VarintReader {
+        const unsigned char *data;
+        const unsigned char *const end;
+    public:
+        VarintReader(const std::string &input, size_t start) : data(reinterpret_cast<const unsigned char*>(input.data())+start),
+            end(reinterpret_cast<const unsigned char*>(input.data())+input.size()) {}
+        size_t nofRemainingBytes() const { return end-data; }
+
+        uint64_t read() {
+            uint64_t value = 0;
+            for (unsigned int shift=0;shift<64;shift+=7) {
+                if (data==end) throw "Error: The encoded enumeration state is truncated.";
+                const unsigned char byte = *(data++);
+                value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+                if ((byte & 0x80)==0) return value;
+            }
+            throw "Error: The encoded enumeration state has an invalid format.";
+        }
+
+        int64_t readSigned() {
+            const uint64_t value = read();
+            return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+        }
+
+        // Reads a signed number and checks that "base" plus that number is an "int"
+        int readInt(int64_t base) {
+            const int64_t difference = readSigned();
+            const int64_t maxDifference = int64_t(1) << 33;
+            if ((difference<-maxDifference) || (difference>maxDifference) || (base+difference<std::numeric_limits<int>::min()) || (base+difference>std::numeric_limits<int>::max())) {
+                throw "Error: The encoded enumeration state has an invalid format.";
+            }
+            return static_cast<int>(base+difference);
+        }
+    };
+
+} // End of namespace detail
+
+    std::string encodeEnumerationState(const EnumerationState &state) {
+        const PointSet *sets[4] = {&state.paretoFront,&state.coParetoElements,&state.negativePoints,&state.positivePoints};
+        const size_t nofDimensions = state.limits.size();
+        for (auto set : sets) {
+            if (set->dimensions()!=nofDimensions) throw "Error: The sets of an enumeration state need to have the same dimension as its limits.";
+        }
+        if (!state.approximationTolerance.empty() && (state.approximationTolerance.size()!=nofDimensions)) throw "Error: The approximation tolerance needs to have one value per dimension.";
+
+        std::string out(encodedStateMagic,sizeof(encodedStateMagic));
+        detail::appendVarint(out,encodedStateVersion);
+        detail::appendVarint(out,nofDimensions);
+        for (auto const &i : state.limits) {
+            detail::appendSignedVarint(out,i.first);
+            detail::appendSignedVarint(out,i.second);
+        }
+        detail::appendVarint(out,state.approximationTolerance.size());
+        for (int i : state.approximationTolerance) detail::appendSignedVarint(out,i);
+        for (auto set : sets) detail::appendVarint(out,set->size());
+        for (auto set : sets) {
+            for (size_t i=0;i<set->size();i++) {
+                for (size_t d=0;d<nofDimensions;d++) {
+                    const int previous = (i==0)?state.limits[d].first:(*set)[i-1][d];
+                    detail::appendSignedVarint(out,(int64_t)(*set)[i][d]-previous);
                 }
             }
-            if (!foundSmaller) cleanedElements.push_back(it);
         }
-        return cleanedElements;
+        return out;
     }
 
+    void decodeEnumerationState(const std::string &data, EnumerationState &state) {
+        if ((data.size()<sizeof(encodedStateMagic)) || !std::equal(encodedStateMagic,encodedStateMagic+sizeof(encodedStateMagic),data.begin())) {
+            throw "Error: The encoded enumeration state has an invalid format.";
+        }
+        detail::VarintReader reader(data,sizeof(encodedStateMagic));
+        if (reader.read()!=encodedStateVersion) throw "Error: The encoded enumeration state has an unsupported format version.";
+        const uint64_t nofDimensions = reader.read();
+        // Every limit takes at least one byte
+        if (nofDimensions>reader.nofRemainingBytes()/2) throw "Error: The encoded enumeration state is truncated.";
+        state.limits.resize(nofDimensions);
+        for (auto &i : state.limits) {
+            i.first = reader.readInt(0);
+            i.second = reader.readInt(0);
+        }
+        const uint64_t nofApproximationTolerances = reader.read();
+        if ((nofApproximationTolerances!=0) && (nofApproximationTolerances!=nofDimensions)) throw "Error: The encoded enumeration state has an invalid format.";
+        state.approximationTolerance.resize(nofApproximationTolerances);
+        for (auto &i : state.approximationTolerance) i = reader.readInt(0);
+        uint64_t nofPoints[4];
+        for (auto &i : nofPoints) i = reader.read();
+
+        PointSet *sets[4] = {&state.paretoFront,&state.coParetoElements,&state.negativePoints,&state.positivePoints};
+        std::vector<int> point(nofDimensions);
+        for (size_t i=0;i<4;i++) {
+            PointSet(nofDimensions).swap(*sets[i]);
+            if (nofDimensions==0) {
+                sets[i]->append(point.data(),nofPoints[i]);
+                continue;
+            }
+            // Every coordinate takes at least one byte
+            if (nofPoints[i]>reader.nofRemainingBytes()/nofDimensions) throw "Error: The encoded enumeration state is truncated.";
+            sets[i]->reserve(nofPoints[i]);
+            for (size_t d=0;d<nofDimensions;d++) point[d] = state.limits[d].first;
+            for (uint64_t j=0;j<nofPoints[i];j++) {
+                for (size_t d=0;d<nofDimensions;d++) point[d] = reader.readInt(point[d]);
+                sets[i]->push_back(point);
+            }
+        }
+        if (reader.nofRemainingBytes()>0) throw "Error: The encoded enumeration state has an invalid format.";
+    }
+
+
+    //=============================================================================================================
+    // Distributed enumeration
+    //=============================================================================================================
+namespace detail {
 
     /**
-     * @brief A class that buffers negative results from the feasibility function so that no
-     * redundant calls are made to it.
-     *
-     * Dominated points are removed from the buffer
+     * @brief What an EnumerationCoordinator knows. The co-Pareto elements of the coordinator form an antichain, and none
+     * of them is greater than or equal to a known Pareto point. The co-Pareto elements of an open work unit were like this
+     * when the work unit was handed out, but the Pareto points found since then can be below them.
      */
-    class NegativeResultBuffer {
-        std::list<std::vector<int> > oldValueBuffer;
+    class CoordinatorData {
     public:
-        bool isContained(const std::vector<int> &data) {
-            for (auto const &a : oldValueBuffer) {
-                if (vectorOfIntIsLeq(data,a)) return true;
+        struct OpenWorkUnit {
+            PointSet coParetoElements;
+            // The Pareto points from this index on were found after the work unit was handed out
+            size_t firstLaterParetoPoint;
+        };
+
+        const std::vector<std::pair<int,int> > limits;
+        const EnumerationOptions options;
+        CoParetoSet<0> coParetoElements;
+        NegativeResultBuffer<0> negativeResultBuffer;
+        PositiveResultBuffer<0> positiveResultBuffer;
+        PointSet paretoFront;
+        PointIndex<0> paretoFrontIndex;
+        std::map<size_t,OpenWorkUnit> openWorkUnits;
+        size_t nextWorkUnitId;
+
+        CoordinatorData(const std::vector<std::pair<int,int> > &_limits, const EnumerationOptions &_options) : limits(_limits), options(_options),
+            coParetoElements(limits,options), negativeResultBuffer(limits,options.packCoordinates), positiveResultBuffer(limits,options.packCoordinates),
+            paretoFront(limits.size()), paretoFrontIndex(limits,options.packCoordinates), nextWorkUnitId(0) {
+            if (!options.approximationTolerance.empty() && (options.approximationTolerance.size()!=limits.size())) throw "Error: The approximation tolerance needs to have one value per dimension.";
+        }
+
+        void checkDimensions(const EnumerationState &state) const {
+            if (state.limits!=limits) throw "Error: The enumeration state is for different limits than the coordinator.";
+            // The Pareto points of an approximation with other tolerances would not be the ones that the coordinator collects
+            if (!state.approximationTolerance.empty() && (state.approximationTolerance!=options.approximationTolerance)) throw "Error: The enumeration state is for other approximation tolerances than the coordinator.";
+            const PointSet *sets[4] = {&state.paretoFront,&state.coParetoElements,&state.negativePoints,&state.positivePoints};
+            for (auto set : sets) {
+                if (set->dimensions()!=limits.size()) throw "Error: The sets of an enumeration state need to have the same dimension as its limits.";
             }
+        }
+
+        void addKnownPoints(const EnumerationState &state) {
+            for (size_t i=0;i<state.negativePoints.size();i++) {
+                if (!negativeResultBuffer.isContained(state.negativePoints[i])) negativeResultBuffer.addPoint(state.negativePoints[i]);
+            }
+            for (size_t i=0;i<state.positivePoints.size();i++) {
+                if (!positiveResultBuffer.isContained(state.positivePoints[i])) positiveResultBuffer.addPoint(state.positivePoints[i]);
+            }
+            // As all points in the sets are Pareto points, a known point that is smaller than or equal to a new one is the
+            // same point.
+            for (size_t i=0;i<state.paretoFront.size();i++) {
+                const int *point = state.paretoFront[i];
+                if (paretoFrontIndex.containsLeq(point)) continue;
+                paretoFront.push_back(point);
+                paretoFrontIndex.insert(point);
+                if (!positiveResultBuffer.isContained(point)) positiveResultBuffer.addPoint(point);
+            }
+        }
+
+        /**
+         * @brief Adds a co-Pareto element unless another one is greater than or equal to it, and removes the ones that
+         * are smaller than it, so that the co-Pareto elements stay an antichain
+         */
+        static void insertCoParetoElement(CoParetoSet<0> &elements, const int *point) {
+            if (elements.containsGeq(point)) return;
+            elements.removeLeq(point);
+            elements.insert(point);
+        }
+
+        /**
+         * @brief Replaces the co-Pareto elements that are greater than or equal to a Pareto point by their children. When
+         * approximating, the Pareto point is lowered by the tolerances first, as in the workers.
+         */
+        void split(CoParetoSet<0> &elements, const int *paretoPoint) const {
+            std::vector<int> splitPoint(paretoPoint,paretoPoint+limits.size());
+            if (!options.approximationTolerance.empty()) {
+                for (size_t d=0;d<limits.size();d++) {
+                    splitPoint[d] = (int)std::max((long long)limits[d].first,(long long)paretoPoint[d]-options.approximationTolerance[d]);
+                }
+            }
+            PointSet dominatedElements(limits.size());
+            elements.extractGeq(splitPoint.data(),dominatedElements);
+            std::vector<int> child(limits.size());
+            for (size_t i=0;i<dominatedElements.size();i++) {
+                for (size_t d=0;d<limits.size();d++) {
+                    if (splitPoint[d]>limits[d].first) {
+                        child.assign(dominatedElements[i],dominatedElements[i]+limits.size());
+                        child[d] = splitPoint[d]-1;
+                        insertCoParetoElement(elements,child.data());
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Takes back co-Pareto elements that were handed out before the Pareto point with index
+         * "firstLaterParetoPoint" was found
+         */
+        void takeBack(CoParetoSet<0> &elements, const PointSet &returnedElements, size_t firstLaterParetoPoint) const {
+            for (size_t i=0;i<returnedElements.size();i++) insertCoParetoElement(elements,returnedElements[i]);
+            for (size_t i=firstLaterParetoPoint;i<paretoFront.size();i++) split(elements,paretoFront[i]);
+        }
+
+        std::map<size_t,OpenWorkUnit>::iterator findOpenWorkUnit(size_t workUnitId) {
+            std::map<size_t,OpenWorkUnit>::iterator it = openWorkUnits.find(workUnitId);
+            if (it==openWorkUnits.end()) throw "Error: There is no open work unit with this ID.";
+            return it;
+        }
+    };
+
+} // End of namespace detail
+
+    EnumerationCoordinator::EnumerationCoordinator(const std::vector<std::pair<int,int> > &limits, const EnumerationOptions &options) : data(new detail::CoordinatorData(limits,options)) {
+        std::vector<int> maximalElement(limits.size());
+        for (size_t i=0;i<limits.size();i++) maximalElement[i] = limits[i].second;
+        data->coParetoElements.insert(maximalElement.data());
+    }
+
+    EnumerationCoordinator::EnumerationCoordinator(const EnumerationState &state, const EnumerationOptions &options) : data(new detail::CoordinatorData(state.limits,options)) {
+        data->checkDimensions(state);
+        data->addKnownPoints(state);
+        for (size_t i=0;i<state.coParetoElements.size();i++) detail::CoordinatorData::insertCoParetoElement(data->coParetoElements,state.coParetoElements[i]);
+    }
+
+    EnumerationCoordinator::~EnumerationCoordinator() {}
+
+    bool EnumerationCoordinator::getWorkUnit(size_t maxNofCoParetoElements, size_t &workUnitId, EnumerationState &workUnit) {
+        if (data->coParetoElements.empty()) return false;
+        const size_t nofDimensions = data->limits.size();
+        workUnit.limits = data->limits;
+        workUnit.approximationTolerance = data->options.approximationTolerance;
+        PointSet *sets[4] = {&workUnit.paretoFront,&workUnit.coParetoElements,&workUnit.negativePoints,&workUnit.positivePoints};
+        for (auto set : sets) PointSet(nofDimensions).swap(*set);
+
+        std::vector<int> point(nofDimensions);
+        detail::PointIndex<0> elements(nofDimensions);
+        while ((workUnit.coParetoElements.size()<std::max(maxNofCoParetoElements,size_t(1))) && !data->coParetoElements.empty()) {
+            data->coParetoElements.pop(point.data());
+            workUnit.coParetoElements.push_back(point);
+            elements.insert(point.data());
+        }
+
+        // The worker only evaluates points below its co-Pareto elements. A feasible point is only of use if it is below one
+        // of them. An infeasible point covers the same of these points as its pointwise minimum with each co-Pareto
+        // element, which is what the worker gets. Handing out only the infeasible points below the co-Pareto elements
+        // would lose the ones that the buffer dropped for a greater point that is not below any of them.
+        PointSet knownPoints(nofDimensions);
+        data->negativeResultBuffer.getPoints(knownPoints);
+        detail::NegativeResultBuffer<0> negativePoints(data->limits,data->options.packCoordinates);
+        for (size_t i=0;i<knownPoints.size();i++) {
+            for (size_t j=0;j<workUnit.coParetoElements.size();j++) {
+                for (size_t d=0;d<nofDimensions;d++) point[d] = std::min(knownPoints[i][d],workUnit.coParetoElements[j][d]);
+                if (!negativePoints.isContained(point.data())) negativePoints.addPoint(point.data());
+            }
+        }
+        negativePoints.getPoints(workUnit.negativePoints);
+        knownPoints.clear();
+        data->positiveResultBuffer.getPoints(knownPoints);
+        for (size_t i=0;i<knownPoints.size();i++) {
+            if (elements.containsGeq(knownPoints[i])) workUnit.positivePoints.push_back(knownPoints[i]);
+        }
+
+        workUnitId = data->nextWorkUnitId++;
+        detail::CoordinatorData::OpenWorkUnit &openWorkUnit = data->openWorkUnits[workUnitId];
+        openWorkUnit.coParetoElements = workUnit.coParetoElements;
+        openWorkUnit.firstLaterParetoPoint = data->paretoFront.size();
+        return true;
+    }
+
+    void EnumerationCoordinator::addResult(size_t workUnitId, const EnumerationState &result) {
+        std::map<size_t,detail::CoordinatorData::OpenWorkUnit>::iterator openWorkUnit = data->findOpenWorkUnit(workUnitId);
+        data->checkDimensions(result);
+        data->addKnownPoints(result);
+        data->takeBack(data->coParetoElements,result.coParetoElements,openWorkUnit->second.firstLaterParetoPoint);
+        data->openWorkUnits.erase(openWorkUnit);
+    }
+
+    void EnumerationCoordinator::returnWorkUnit(size_t workUnitId) {
+        std::map<size_t,detail::CoordinatorData::OpenWorkUnit>::iterator openWorkUnit = data->findOpenWorkUnit(workUnitId);
+        data->takeBack(data->coParetoElements,openWorkUnit->second.coParetoElements,openWorkUnit->second.firstLaterParetoPoint);
+        data->openWorkUnits.erase(openWorkUnit);
+    }
+
+    size_t EnumerationCoordinator::nofOpenWorkUnits() const {
+        return data->openWorkUnits.size();
+    }
+
+    bool EnumerationCoordinator::isFinished() const {
+        return data->coParetoElements.empty() && data->openWorkUnits.empty();
+    }
+
+    const PointSet &EnumerationCoordinator::getParetoFront() const {
+        return data->paretoFront;
+    }
+
+    void EnumerationCoordinator::getState(EnumerationState &state) const {
+        const size_t nofDimensions = data->limits.size();
+        state.limits = data->limits;
+        state.approximationTolerance = data->options.approximationTolerance;
+        PointSet *sets[4] = {&state.paretoFront,&state.coParetoElements,&state.negativePoints,&state.positivePoints};
+        for (auto set : sets) PointSet(nofDimensions).swap(*set);
+        state.paretoFront = data->paretoFront;
+        data->negativeResultBuffer.getPoints(state.negativePoints);
+        data->positiveResultBuffer.getPoints(state.positivePoints);
+
+        // Take back the co-Pareto elements of the open work units in a copy of the co-Pareto elements
+        EnumerationOptions copyOptions;
+        copyOptions.packCoordinates = data->options.packCoordinates;
+        detail::CoParetoSet<0> elements(data->limits,copyOptions);
+        PointSet points(nofDimensions);
+        data->coParetoElements.getPoints(points);
+        for (size_t i=0;i<points.size();i++) elements.insert(points[i]);
+        for (auto const &openWorkUnit : data->openWorkUnits) {
+            data->takeBack(elements,openWorkUnit.second.coParetoElements,openWorkUnit.second.firstLaterParetoPoint);
+        }
+        elements.getPoints(state.coParetoElements);
+    }
+
+
+    //=============================================================================================================
+    // Refining approximations
+    //=============================================================================================================
+    void refineEnumerationState(const EnumerationState &approximate, EnumerationState &exact) {
+        const size_t nofDimensions = approximate.limits.size();
+        const PointSet *sets[4] = {&approximate.paretoFront,&approximate.coParetoElements,&approximate.negativePoints,&approximate.positivePoints};
+        for (auto set : sets) {
+            if (!set->empty() && (set->dimensions()!=nofDimensions)) throw "Error: The sets of an enumeration state need to have the same dimension as its limits.";
+        }
+
+        // The feasible points of the approximation, which include the points that it found unless they went to a sink.
+        // Only the minimal ones matter.
+        PointSet feasiblePoints(nofDimensions);
+        for (size_t i=0;i<approximate.paretoFront.size();i++) feasiblePoints.push_back(approximate.paretoFront[i]);
+        for (size_t i=0;i<approximate.positivePoints.size();i++) feasiblePoints.push_back(approximate.positivePoints[i]);
+        PointSet minimalFeasiblePoints = cleanParetoFront(feasiblePoints);
+
+        // Every Pareto point is either one of the minimal feasible points or not greater than or equal to any of them. The
+        // former are below themselves, and the latter below the co-Pareto elements that splitting the maximal point
+        // exactly by all of them leaves. The co-Pareto elements of the approximation are below the latter, too.
+        std::vector<int> point(nofDimensions);
+        for (size_t i=0;i<nofDimensions;i++) point[i] = approximate.limits[i].second;
+        EnumerationOptions options;
+        detail::CoParetoSet<0> elements(approximate.limits,options);
+        elements.insert(point.data());
+        PointSet dominatedElements(nofDimensions);
+        PointSet children(nofDimensions);
+        for (size_t i=0;i<minimalFeasiblePoints.size();i++) {
+            dominatedElements.clear();
+            detail::updateCoParetoElements(elements,minimalFeasiblePoints[i],approximate.limits,dominatedElements,children);
+        }
+        for (size_t i=0;i<minimalFeasiblePoints.size();i++) detail::CoordinatorData::insertCoParetoElement(elements,minimalFeasiblePoints[i]);
+
+        exact.limits = approximate.limits;
+        exact.approximationTolerance.clear();
+        PointSet *exactSets[4] = {&exact.paretoFront,&exact.coParetoElements,&exact.negativePoints,&exact.positivePoints};
+        for (auto set : exactSets) PointSet(nofDimensions).swap(*set);
+        elements.getPoints(exact.coParetoElements);
+        for (size_t i=0;i<approximate.negativePoints.size();i++) exact.negativePoints.push_back(approximate.negativePoints[i]);
+        exact.positivePoints.swap(minimalFeasiblePoints);
+    }
+
+
+    //=============================================================================================================
+    // Oracle cache. Every slot has a flag byte with the bits below. Slots are freed by moving the entries after them in
+    // the same run of occupied slots back, so that no markers for deleted entries are needed.
+    //=============================================================================================================
+    const unsigned char cacheSlotOccupied = 1;
+    const unsigned char cacheSlotReferenced = 2;
+    const unsigned char cacheSlotFeasible = 4;
+
+    OracleCache::OracleCache(size_t _nofDimensions, size_t capacity, CacheEviction _eviction) : nofDimensions(_nofDimensions), maxNofEntries(capacity),
+        eviction(_eviction), nofEntries(0), clockHand(0), nofHitsSoFar(0), nofMissesSoFar(0), nofEvictionsSoFar(0) {
+        if (capacity==0) throw "Error: The capacity of an oracle cache must be positive.";
+        // At most half of the slots are occupied, which keeps the runs of occupied slots short.
+        size_t nofSlots = 8;
+        while (nofSlots<2*capacity) nofSlots *= 2;
+        slotMask = nofSlots-1;
+        keys.resize(nofSlots*nofDimensions);
+        hashes.resize(nofSlots);
+        flags.resize(nofSlots,0);
+    }
+
+    uint32_t OracleCache::hash(const int *point) const {
+        uint64_t value = 0x243F6A8885A308D3ull;
+        for (size_t d=0;d<nofDimensions;d++) {
+            value = (value ^ static_cast<uint32_t>(point[d]))*0x9E3779B97F4A7C15ull;
+            value ^= value >> 29;
+        }
+        return static_cast<uint32_t>(value ^ (value >> 32));
+    }
+
+    /**
+     * @brief Finds the slot of a point, or the free slot at which it would be inserted
+     */
+    bool OracleCache::find(const int *point, uint32_t pointHash, size_t &slot) const {
+        slot = pointHash & slotMask;
+        while (flags[slot] & cacheSlotOccupied) {
+            if ((hashes[slot]==pointHash) && std::equal(point,point+nofDimensions,keys.begin()+slot*nofDimensions)) return true;
+            slot = (slot+1) & slotMask;
+        }
+        return false;
+    }
+
+    void OracleCache::erase(size_t slot) {
+        size_t next = slot;
+        while (true) {
+            next = (next+1) & slotMask;
+            if (!(flags[next] & cacheSlotOccupied)) break;
+            // The entry in "next" can be moved to "slot" unless its home slot is cyclically in (slot,next].
+            const size_t home = hashes[next] & slotMask;
+            const bool homeAfterSlot = (next>slot)?((home>slot) && (home<=next)):((home>slot) || (home<=next));
+            if (homeAfterSlot) continue;
+            std::copy(keys.begin()+next*nofDimensions,keys.begin()+(next+1)*nofDimensions,keys.begin()+slot*nofDimensions);
+            hashes[slot] = hashes[next];
+            flags[slot] = flags[next];
+            slot = next;
+        }
+        flags[slot] = 0;
+        nofEntries--;
+    }
+
+    bool OracleCache::lookup(const int *point, bool &result) {
+        size_t slot;
+        if (!find(point,hash(point),slot)) {
+            nofMissesSoFar++;
             return false;
         }
+        nofHitsSoFar++;
+        flags[slot] |= cacheSlotReferenced;
+        result = (flags[slot] & cacheSlotFeasible)!=0;
+        return true;
+    }
 
-        void addPoint(const std::vector<int> &data) {
-            for (auto it = oldValueBuffer.begin();it!=oldValueBuffer.end();) {
-                if (vectorOfIntIsLeq(*it,data)) {
-                    it = oldValueBuffer.erase(it);
+    void OracleCache::insert(const int *point, bool result) {
+        const uint32_t pointHash = hash(point);
+        size_t slot;
+        if (find(point,pointHash,slot)) {
+            flags[slot] = cacheSlotOccupied | cacheSlotReferenced | (result?cacheSlotFeasible:0);
+            return;
+        }
+        if (nofEntries==maxNofEntries) {
+            if (eviction==EVICT_NOTHING) return;
+            // The clock hand gives every referenced entry a second chance, so it stops within two rounds.
+            while (true) {
+                clockHand = (clockHand+1) & slotMask;
+                if (!(flags[clockHand] & cacheSlotOccupied)) continue;
+                if (flags[clockHand] & cacheSlotReferenced) {
+                    flags[clockHand] &= ~cacheSlotReferenced;
                 } else {
-                    it++;
+                    erase(clockHand);
+                    nofEvictionsSoFar++;
+                    break;
                 }
             }
-            oldValueBuffer.push_back(data);
+            find(point,pointHash,slot);
         }
-    };
+        std::copy(point,point+nofDimensions,keys.begin()+slot*nofDimensions);
+        hashes[slot] = pointHash;
+        flags[slot] = cacheSlotOccupied | (result?cacheSlotFeasible:0);
+        nofEntries++;
+    }
+
+    void OracleCache::clear() {
+        std::fill(flags.begin(),flags.end(),0);
+        nofEntries = 0;
+    }
 
 
+    //=============================================================================================================
+    // Hypervolumes
+    //=============================================================================================================
+namespace detail {
+
     /**
-     * @brief Main function of the pareto front element enumeration algorithm
-     * @param fn the feasibility function
-     * @param limits the upper and lower bounds of the objective values. In every pair, the minimal value comes first.
-     * @return the list of Pareto points.
+     * The boxes are sorted by their extents in the last dimension. The slab between the k-th and the (k+1)-th largest of
+     * them is covered by the first k boxes, so the volume of the slab is its height times the volume of the union of these
+     * boxes in the other dimensions, which is computed recursively. Boxes that are contained in another one there are left
+     * out. In two dimensions, the latter volume is the largest extent of these boxes in the first dimension.
      */
-    std::list<std::vector<int> > enumerateParetoFront(std::function<bool(const std::vector<int> &)> fn, const std::vector<std::pair<int,int> > &limits) {
-
-        // Buffer the number of dimensions of the search space
-        unsigned const int nofDimensions = limits.size();
-
-        // Reserve the sets "P" and "S" from the paper
-        std::list<std::vector<int> > paretoFront;
-        std::list<std::vector<int> > coParetoElements;
-
-        // Negative result buffer
-        NegativeResultBuffer negativeResultBuffer;
-
-        // Add the maximal element to the coParetoElements
-        {
-            std::vector<int> maximalElement;
-            for (auto const i : limits) {
-                maximalElement.push_back(i.second);
-            }
-            coParetoElements.push_back(maximalElement);
-        }
-
-        // Main loop
-        while (!coParetoElements.empty()) {
-            std::vector<int> &testPoint = coParetoElements.front();
-            if (!(negativeResultBuffer.isContained(testPoint))) {
-                if (fn(testPoint)) {
-                    // A Pareto point is missing. Let us find where exactly it is.
-                    // We need to work on a copy of the point in order not to spoil
-                    // the point form the coParetoElements
-                    std::vector<int> x = testPoint;
-                    for (unsigned int i=0;i<nofDimensions;i++) {
-                        int max = x[i]+1;
-                        int min = limits[i].first;
-                        while ((max - min)>1) {
-                            int mid = min + ((max-min-1)/2);
-                            x[i] = mid;
-                            if (negativeResultBuffer.isContained(x)) {
-                                min = mid+1;
-                            } else {
-                                if (fn(x)) {
-                                    max = mid+1;
-                                } else {
-                                    min = mid+1;
-                                    negativeResultBuffer.addPoint(x);
-                                }
-                            }
-                        }
-                        x[i] = min;
-                    }
-                    paretoFront.push_back(x);
-
-                    // Now update all points in the coParetoFront
-                    std::list<std::vector<int> > coParetoElementsMod;
-                    for (auto const &y : coParetoElements) {
-                        if (!vectorOfIntIsLeq(x,y)) {
-                            coParetoElementsMod.push_back(y);
-                        } else {
-                            for (unsigned int i=0;i<nofDimensions;i++) {
-                                if (x[i]>limits[i].first) {
-                                    coParetoElementsMod.push_back(y);
-                                    std::vector<int> &mod = coParetoElementsMod.back();
-                                    mod[i] = x[i]-1;
-                                }
-                            }
-                        }
+    double volumeOfUnion(const std::vector<double> &extents, size_t nofDimensions) {
+        const size_t nofBoxes = extents.size()/nofDimensions;
+        if (nofBoxes==0) return 0.0;
+        if (nofDimensions==1) return *std::max_element(extents.begin(),extents.end());
+
+        const size_t last = nofDimensions-1;
+        std::vector<size_t> order(nofBoxes);
+        for (size_t i=0;i<nofBoxes;i++) order[i] = i;
+        std::sort(order.begin(),order.end(),[&extents,nofDimensions,last](size_t a, size_t b) {
+            return extents[a*nofDimensions+last]>extents[b*nofDimensions+last];
+        });
+
+        double volume = 0.0;
+        double width = 0.0; // For two dimensions
+        std::vector<double> slabBoxes; // For more dimensions, "last" values per box
+        for (size_t k=0;k<nofBoxes;k++) {
+            const double *box = &(extents[order[k]*nofDimensions]);
+            const double height = box[last]-((k+1<nofBoxes)?extents[order[k+1]*nofDimensions+last]:0.0);
+            if (nofDimensions==2) {
+                width = std::max(width,box[0]);
+                volume += height*width;
+                continue;
+            }
+
+            bool contained = false;
+            for (size_t i=0;(i<slabBoxes.size()) && !contained;i+=last) {
+                contained = std::equal(box,box+last,&(slabBoxes[i]),std::less_equal<double>());
+            }
+            if (!contained) {
+                size_t nofKept = 0;
+                for (size_t i=0;i<slabBoxes.size();i+=last) {
+                    if (!std::equal(&(slabBoxes[i]),&(slabBoxes[i])+last,box,std::less_equal<double>())) {
+                        std::copy(slabBoxes.begin()+i,slabBoxes.begin()+i+last,slabBoxes.begin()+nofKept);
+                        nofKept += last;
                     }
-                    coParetoElements = cleanParetoFront(coParetoElementsMod);
+                }
+                slabBoxes.resize(nofKept);
+                slabBoxes.insert(slabBoxes.end(),box,box+last);
+            }
+            if (height>0.0) volume += height*volumeOfUnion(slabBoxes,last);
+        }
+        return volume;
+    }
 
-                } else {
-                    // Get rid of this point in the co-Pareto front and add to the negative results buffer
-                    negativeResultBuffer.addPoint(testPoint);
-                    coParetoElements.pop_front();
+
+    //=============================================================================================================
+    // Spill files. The points of a chunk are stored as raw coordinates, one point after the other.
+    //=============================================================================================================
+    SpillFile::SpillFile(size_t _nofDimensions, const std::string &directory) : nofDimensions(_nofDimensions), file(NULL), end(0), nofPointsInChunks(0) {
+#if defined(__unix__) || defined(__APPLE__)
+        if (!directory.empty()) {
+            std::string filename = directory+"/pareto_enumerator_spill_XXXXXX";
+            int fd = mkstemp(&(filename[0]));
+            if (fd<0) throw "Error: Could not create a spill file.";
+            // The file goes away with its last descriptor
+            unlink(filename.c_str());
+            file = fdopen(fd,"w+b");
+            if (file==NULL) close(fd);
+        } else {
+            file = std::tmpfile();
+        }
+#else
+        // Without mkstemp, the file is always created in the directory for temporary files
+        (void)directory;
+        file = std::tmpfile();
+#endif
+        if (file==NULL) throw "Error: Could not create a spill file.";
+    }
+
+    SpillFile::~SpillFile() {
+        std::fclose(file);
+    }
+
+    void SpillFile::seek(uint64_t offset) {
+#if defined(__unix__) || defined(__APPLE__)
+        const bool failed = fseeko(file,static_cast<off_t>(offset),SEEK_SET)!=0;
+#else
+        const bool failed = (offset>static_cast<uint64_t>(std::numeric_limits<long>::max())) || (std::fseek(file,static_cast<long>(offset),SEEK_SET)!=0);
+#endif
+        if (failed) throw "Error: Could not seek in a spill file.";
+    }
+
+    void SpillFile::append(const PointSet &points) {
+        if (points.dimensions()!=nofDimensions) throw "Error: The points for a spill file have a wrong number of dimensions.";
+        const std::vector<int> &coordinates = points.coordinates();
+        seek(end);
+        if (std::fwrite(coordinates.data(),sizeof(int),coordinates.size(),file)!=coordinates.size()) throw "Error: Could not write to a spill file.";
+        chunkStarts.push_back(end);
+        chunkSizes.push_back(points.size());
+        end += coordinates.size()*sizeof(int);
+        nofPointsInChunks += points.size();
+    }
+
+    void SpillFile::read(size_t chunk, PointSet &out) {
+        if (fflush(file)!=0) throw "Error: Could not write to a spill file.";
+        std::vector<int> coordinates(chunkSizes[chunk]*nofDimensions);
+        seek(chunkStarts[chunk]);
+        if (std::fread(coordinates.data(),sizeof(int),coordinates.size(),file)!=coordinates.size()) throw "Error: Could not read from a spill file.";
+        out.append(coordinates.data(),chunkSizes[chunk]);
+    }
+
+    void SpillFile::popLast(PointSet &out) {
+        read(chunkStarts.size()-1,out);
+        end = chunkStarts.back();
+        nofPointsInChunks -= chunkSizes.back();
+        chunkStarts.pop_back();
+        chunkSizes.pop_back();
+    }
+
+    /**
+     * @brief Removes all dominating elements from a set of search space points on several threads. The input is split
+     * into one chunk per thread. Every point that is maximal in the input is also maximal within its chunk, so the
+     * chunks are first cleaned locally. The remaining candidates are then ordered by descending coordinate sum and each
+     * of them is compared against the candidates before it, where the threads take blocks of candidates in turn.
+     * @param input The initial set of points
+     * @param cleanedElements The set into which the cleaned set of points is written. Must be different from "input".
+     * The points keep their order from "input".
+     * @param nofThreads The number of threads to use, including the calling one
+     */
+    void cleanParetoFront(const PointSet &input, PointSet &cleanedElements, unsigned int nofThreads) {
+        const size_t nofDimensions = input.dimensions();
+        const size_t chunkSize = (input.size()+nofThreads-1)/std::max(nofThreads,1u);
+        // The sweep for two and three dimensions is faster on one thread than the filter below on several threads
+        if ((nofThreads<=1) || (chunkSize<blockCapacity) || (nofDimensions==2) || (nofDimensions==3)) {
+            cleanParetoFront(input,cleanedElements);
+            return;
+        }
+        const size_t nofChunks = (input.size()+chunkSize-1)/chunkSize;
+        ThreadPool threadPool(nofThreads);
+
+        // Clean the chunks locally
+        std::vector<char> isCandidate(input.size());
+        threadPool.run(nofChunks,[&](size_t, size_t chunk) {
+            const size_t start = chunk*chunkSize;
+            const size_t count = std::min(chunkSize,input.size()-start);
+            PointSet chunkPoints(nofDimensions);
+            chunkPoints.append(input[start],count);
+            std::vector<char> isMaximal(count,false);
+            markMaximalPointsBySortFilter(chunkPoints,isMaximal);
+            std::copy(isMaximal.begin(),isMaximal.end(),isCandidate.begin()+start);
+        });
+
+        // Check the candidates against each other. A candidate can only be smaller than candidates with a larger
+        // coordinate sum, which come before it in the blocks.
+        std::vector<std::pair<int64_t,size_t> > order;
+        for (size_t i=0;i<input.size();i++) {
+            if (!isCandidate[i]) continue;
+            int64_t sum = 0;
+            for (size_t d=0;d<nofDimensions;d++) sum += input[i][d];
+            order.push_back(std::pair<int64_t,size_t>(-sum,i));
+        }
+        std::sort(order.begin(),order.end());
+        const size_t nofBlocks = (order.size()+blockCapacity-1)/blockCapacity;
+        std::vector<int> blocks(nofBlocks*blockCapacity*nofDimensions);
+        for (size_t i=0;i<order.size();i++) {
+            int *block = &(blocks[(i/blockCapacity)*blockCapacity*nofDimensions]);
+            for (size_t d=0;d<nofDimensions;d++) block[d*blockCapacity+(i % blockCapacity)] = input[order[i].second][d];
+        }
+        const BlockKernel geqKernel = getBlockKernels<0>().geq;
+        threadPool.run(nofBlocks,[&](size_t, size_t block) {
+            const size_t end = std::min((block+1)*blockCapacity,order.size());
+            for (size_t i=block*blockCapacity;i<end;i++) {
+                const int *point = input[order[i].second];
+                bool foundSmaller = false;
+                for (size_t b=0;(b<=block) && !foundSmaller;b++) {
+                    uint64_t mask = geqKernel(&(blocks[b*blockCapacity*nofDimensions]),point,nofDimensions,maskOfFirstElements(order.size()-b*blockCapacity));
+                    while ((mask!=0) && !foundSmaller) {
+                        foundSmaller = pointIsSmaller(point,input[order[b*blockCapacity+indexOfLowestBit(mask)].second],nofDimensions);
+                        mask &= mask-1;
+                    }
                 }
-            } else {
-                // Get rid of this point in the co-Pareto front
-                coParetoElements.pop_front();
+                isCandidate[order[i].second] = !foundSmaller;
             }
+        });
+
+        cleanedElements.clear();
+        for (size_t i=0;i<input.size();i++) {
+            if (isCandidate[i]) cleanedElements.push_back(input[i]);
         }
-        return paretoFront;
+    }
+
+} // End of namespace detail
+
+    PointSet cleanParetoFront(const PointSet &input, unsigned int nofThreads) {
+        PointSet cleanedElements(input.dimensions());
+        detail::cleanParetoFront(input,cleanedElements,nofThreads);
+        return cleanedElements;
+    }
+
+    std::list<std::vector<int> > cleanParetoFront(const std::list<std::vector<int> > &input, unsigned int nofThreads) {
+        if (input.empty()) return input;
+        return cleanParetoFront(PointSet(input.front().size(),input),nofThreads).toList();
+    }
+
+
+namespace detail {
+
+    // The enumerators for the variants of the main function below, including the ones for fixed numbers of dimensions
+    template void runEnumerator<SinglePointOracle<PointFunction>,StatsRecorder>(SinglePointOracle<PointFunction> &, const std::vector<std::pair<int,int> > &, PointSet *, const std::function<void(const std::vector<int> &)> *, const EnumerationOptions &);
+    template void runEnumerator<SinglePointOracle<PointFunction>,NoStatsRecorder>(SinglePointOracle<PointFunction> &, const std::vector<std::pair<int,int> > &, PointSet *, const std::function<void(const std::vector<int> &)> *, const EnumerationOptions &);
+    template void runEnumerator<ParallelOracle<PointFunction>,StatsRecorder>(ParallelOracle<PointFunction> &, const std::vector<std::pair<int,int> > &, PointSet *, const std::function<void(const std::vector<int> &)> *, const EnumerationOptions &);
+    template void runEnumerator<ParallelOracle<PointFunction>,NoStatsRecorder>(ParallelOracle<PointFunction> &, const std::vector<std::pair<int,int> > &, PointSet *, const std::function<void(const std::vector<int> &)> *, const EnumerationOptions &);
+    template void runEnumerator<BatchOracle<BatchFunction>,StatsRecorder>(BatchOracle<BatchFunction> &, const std::vector<std::pair<int,int> > &, PointSet *, const std::function<void(const std::vector<int> &)> *, const EnumerationOptions &);
+    template void runEnumerator<BatchOracle<BatchFunction>,NoStatsRecorder>(BatchOracle<BatchFunction> &, const std::vector<std::pair<int,int> > &, PointSet *, const std::function<void(const std::vector<int> &)> *, const EnumerationOptions &);
+    template void runEnumerator<AsyncOracle<AsyncPointFunction>,StatsRecorder>(AsyncOracle<AsyncPointFunction> &, const std::vector<std::pair<int,int> > &, PointSet *, const std::function<void(const std::vector<int> &)> *, const EnumerationOptions &);
+    template void runEnumerator<AsyncOracle<AsyncPointFunction>,NoStatsRecorder>(AsyncOracle<AsyncPointFunction> &, const std::vector<std::pair<int,int> > &, PointSet *, const std::function<void(const std::vector<int> &)> *, const EnumerationOptions &);
+
+} // End of namespace detail
+
+    /**
+     * @brief Main function of the pareto front element enumeration algorithm
+     * @param fn the feasibility function. It must be thread-safe if "options.nofThreads" is greater than 1.
+     * @param limits the upper and lower bounds of the objective values. In every pair, the minimal value comes first.
+     * @param paretoFront the set to which the Pareto points are written. Its previous content is discarded.
+     * @param options further settings for the enumeration
+     */
+    void enumerateParetoFront(std::function<bool(const std::vector<int> &)> fn, const std::vector<std::pair<int,int> > &limits, PointSet &paretoFront, const EnumerationOptions &options) {
+        detail::runEnumeration(fn,limits,&paretoFront,NULL,options);
+    }
+
+    /**
+     * @brief Main function of the pareto front element enumeration algorithm
+     * @param fn the feasibility function. It must be thread-safe if "options.nofThreads" is greater than 1.
+     * @param limits the upper and lower bounds of the objective values. In every pair, the minimal value comes first.
+     * @param options further settings for the enumeration
+     * @return the list of Pareto points.
+     */
+    std::list<std::vector<int> > enumerateParetoFront(std::function<bool(const std::vector<int> &)> fn, const std::vector<std::pair<int,int> > &limits, const EnumerationOptions &options) {
+        PointSet paretoFront;
+        detail::runEnumeration(fn,limits,&paretoFront,NULL,options);
+        return paretoFront.toList();
+    }
+
+    /**
+     * @brief Variant of the main function that passes every Pareto point to a function as soon as it is found rather
+     * than keeping the Pareto front in memory
+     * @param fn the feasibility function. It must be thread-safe if "options.nofThreads" is greater than 1.
+     * @param limits the upper and lower bounds of the objective values. In every pair, the minimal value comes first.
+     * @param paretoPointSink the function that gets the Pareto points. It is always called from the thread that called
+     *        this function. If the enumeration continues from a state file, it first gets the Pareto points in that file,
+     *        but since the Pareto front is not kept, the state files written by this function do not contain them.
+     * @param options further settings for the enumeration
+     */
+    void enumerateParetoFront(std::function<bool(const std::vector<int> &)> fn, const std::vector<std::pair<int,int> > &limits, const std::function<void(const std::vector<int> &)> &paretoPointSink, const EnumerationOptions &options) {
+        detail::runEnumeration(fn,limits,NULL,&paretoPointSink,options);
+    }
+
+    /**
+     * @brief Variant of the main function for feasibility functions that evaluate several points at once
+     * @param fn the batch feasibility function. It gets up to "options.maxBatchSize" points and returns one result per point.
+     * @param limits the upper and lower bounds of the objective values. In every pair, the minimal value comes first.
+     * @param paretoFront the set to which the Pareto points are written. Its previous content is discarded.
+     * @param options further settings for the enumeration
+     */
+    void enumerateParetoFront(std::function<std::vector<bool>(const PointBatch &)> fn, const std::vector<std::pair<int,int> > &limits, PointSet &paretoFront, const EnumerationOptions &options) {
+        detail::runEnumeration(fn,limits,&paretoFront,NULL,options);
+    }
+
+    std::list<std::vector<int> > enumerateParetoFront(std::function<std::vector<bool>(const PointBatch &)> fn, const std::vector<std::pair<int,int> > &limits, const EnumerationOptions &options) {
+        PointSet paretoFront;
+        detail::runEnumeration(fn,limits,&paretoFront,NULL,options);
+        return paretoFront.toList();
+    }
+
+    void enumerateParetoFront(std::function<std::vector<bool>(const PointBatch &)> fn, const std::vector<std::pair<int,int> > &limits, const std::function<void(const std::vector<int> &)> &paretoPointSink, const EnumerationOptions &options) {
+        detail::runEnumeration(fn,limits,NULL,&paretoPointSink,options);
+    }
+
+    /**
+     * @brief Variant of the main function for asynchronous feasibility functions
+     * @param fn the feasibility function. It starts the evaluation of a point and returns a future for the result. It is
+     *        always called from the thread that called this function, and up to "options.maxBatchSize" calls are pending
+     *        at the same time. The point passed to it stays valid until its future is ready.
+     * @param limits the upper and lower bounds of the objective values. In every pair, the minimal value comes first.
+     * @param paretoFront the set to which the Pareto points are written. Its previous content is discarded.
+     * @param options further settings for the enumeration
+     */
+    void enumerateParetoFront(std::function<std::future<bool>(const std::vector<int> &)> fn, const std::vector<std::pair<int,int> > &limits, PointSet &paretoFront, const EnumerationOptions &options) {
+        detail::runEnumeration(fn,limits,&paretoFront,NULL,options);
+    }
+
+    std::list<std::vector<int> > enumerateParetoFront(std::function<std::future<bool>(const std::vector<int> &)> fn, const std::vector<std::pair<int,int> > &limits, const EnumerationOptions &options) {
+        PointSet paretoFront;
+        detail::runEnumeration(fn,limits,&paretoFront,NULL,options);
+        return paretoFront.toList();
+    }
+
+    void enumerateParetoFront(std::function<std::future<bool>(const std::vector<int> &)> fn, const std::vector<std::pair<int,int> > &limits, const std::function<void(const std::vector<int> &)> &paretoPointSink, const EnumerationOptions &options) {
+        detail::runEnumeration(fn,limits,NULL,&paretoPointSink,options);
     }
 
 } // End of namespace
+
@@ -38,17 +38,530 @@
  * SOFTWARE.
  */
 
+#include <algorithm>
+#include <atomic>
+#include <limits>
 #include <list>
+#include <memory>
 #include <vector>
 #include <functional>
+#include <future>
+#include <cstddef>
+#include <cstdint>
+#include <string>
 
 namespace paretoenumerator {
 
+    /**
+     * @brief A set of points of the same dimension. All coordinates are stored in a single buffer, one point after
+     * the other, so that adding a point does not need an allocation of its own.
+     */
+    class PointSet {
+        size_t nofDimensions;
+        size_t nofPoints;
+        std::vector<int> data;
+    public:
+        PointSet(size_t _nofDimensions = 0) : nofDimensions(_nofDimensions), nofPoints(0) {}
+        PointSet(size_t _nofDimensions, const std::list<std::vector<int> > &points) : nofDimensions(_nofDimensions), nofPoints(0) {
+            data.reserve(points.size()*nofDimensions);
+            for (auto const &a : points) push_back(a);
+        }
+
+        size_t dimensions() const { return nofDimensions; }
+        size_t size() const { return nofPoints; }
+        bool empty() const { return nofPoints==0; }
+
+        const int *operator[](size_t index) const { return data.data()+index*nofDimensions; }
+        int *operator[](size_t index) { return data.data()+index*nofDimensions; }
+        const int *back() const { return (*this)[nofPoints-1]; }
+        int *back() { return (*this)[nofPoints-1]; }
+
+        void push_back(const int *point) {
+            data.insert(data.end(),point,point+nofDimensions);
+            nofPoints++;
+        }
+        void push_back(const std::vector<int> &point) { push_back(point.data()); }
+
+        /**
+         * @brief Appends "count" points whose coordinates are stored one after the other in "points"
+         */
+        void append(const int *points, size_t count) {
+            data.insert(data.end(),points,points+count*nofDimensions);
+            nofPoints += count;
+        }
+        void pop_back() {
+            nofPoints--;
+            data.resize(nofPoints*nofDimensions);
+        }
+
+        /**
+         * @brief Removes a point by moving the last point of the set to its place.
+         */
+        void swapRemove(size_t index) {
+            if (index+1<nofPoints) std::copy(back(),back()+nofDimensions,(*this)[index]);
+            pop_back();
+        }
+
+        void clear() {
+            data.clear();
+            nofPoints = 0;
+        }
+        void reserve(size_t capacity) { data.reserve(capacity*nofDimensions); }
+        void swap(PointSet &other) {
+            std::swap(nofDimensions,other.nofDimensions);
+            std::swap(nofPoints,other.nofPoints);
+            data.swap(other.data);
+        }
+
+        // All coordinates, one point after the other
+        const std::vector<int> &coordinates() const { return data; }
+
+        std::vector<int> point(size_t index) const { return std::vector<int>((*this)[index],(*this)[index]+nofDimensions); }
+        std::list<std::vector<int> > toList() const {
+            std::list<std::vector<int> > result;
+            for (size_t i=0;i<nofPoints;i++) result.push_back(point(i));
+            return result;
+        }
+    };
+
+    // Points that are handed to a batch feasibility function at once
+    typedef PointSet PointBatch;
+
+    /**
+     * @brief Statistics about a run of the enumeration algorithm. Times are in seconds.
+     */
+    struct EnumerationStats {
+        // Calls to the feasibility function, split by their result and by whether they tested a co-Pareto element or
+        // were made by the search for a Pareto point below a feasible co-Pareto element. Every point counts as one call.
+        size_t nofOracleCalls;
+        size_t nofFeasibleOracleCalls;
+        size_t nofInfeasibleOracleCalls;
+        size_t nofCoParetoOracleCalls;
+        size_t nofSearchOracleCalls;
+
+        // Lookups in the negative result buffer, how many of them found a point, and how many nodes of the index of the
+        // buffer they visited in total
+        size_t nofNegativeBufferLookups;
+        size_t nofNegativeBufferHits;
+        size_t nofNegativeBufferNodesVisited;
+
+        // The largest sizes that the set of co-Pareto elements and the negative result buffer reached
+        size_t maxNofCoParetoElements;
+        size_t maxNofNegativePoints;
+
+        // The time spent in the feasibility function, the time spent in the rest of the algorithm, and the part of the
+        // latter that went into updating the co-Pareto elements after finding a Pareto point (which replaces the calls
+        // to "cleanParetoFront" in the paper)
+        double oracleTime;
+        double bookkeepingTime;
+        double coParetoUpdateTime;
+
+        // The number of Pareto points found in the run and, for every dimension, the calls to the feasibility function
+        // that the searches for them made while lowering this dimension. Pareto points from an earlier run that the run
+        // continues from are not counted.
+        size_t nofParetoPointsFound;
+        std::vector<size_t> nofSearchOracleCallsPerDimension;
+
+        // The points whose results were found in "EnumerationOptions::oracleCache". They are not counted as calls above.
+        size_t nofOracleCacheHits;
+
+        // The largest number of bytes that the co-Pareto elements and the result buffers took in memory, and how many
+        // co-Pareto elements and infeasible points were moved to spill files because of "EnumerationOptions::memoryLimit"
+        size_t maxMemoryUsage;
+        size_t nofSpilledCoParetoElements;
+        size_t nofSpilledNegativePoints;
+
+        EnumerationStats() : nofOracleCalls(0), nofFeasibleOracleCalls(0), nofInfeasibleOracleCalls(0), nofCoParetoOracleCalls(0),
+            nofSearchOracleCalls(0), nofNegativeBufferLookups(0), nofNegativeBufferHits(0), nofNegativeBufferNodesVisited(0),
+            maxNofCoParetoElements(0), maxNofNegativePoints(0), oracleTime(0.0), bookkeepingTime(0.0), coParetoUpdateTime(0.0),
+            nofParetoPointsFound(0), nofOracleCacheHits(0), maxMemoryUsage(0), nofSpilledCoParetoElements(0), nofSpilledNegativePoints(0) {}
+    };
+
+    /**
+     * @brief The order in which the enumeration algorithm takes the co-Pareto elements (the set "S" from the paper) for
+     * testing them with the feasibility function. It influences how many of them are found to be redundant because of
+     * earlier results, and thus the number of calls to the feasibility function.
+     */
+    enum CoParetoSelection {
+        // Whatever element the index of the co-Pareto elements can remove fastest. This has no overhead.
+        SELECT_IN_INDEX_ORDER,
+        // The element for which the box between the lower limits and the element has the largest volume. If it is
+        // infeasible, all elements in this box are known to be infeasible, too.
+        SELECT_LARGEST_BOX_FIRST,
+        // The dimensions take turns, and each time, the element with the largest value in the current dimension is taken
+        SELECT_ROUND_ROBIN,
+        // The element for which "EnumerationOptions::selectionPriority" is the largest
+        SELECT_BY_PRIORITY,
+        // The element below which the volume of the points that are not known to be infeasible is the largest, so that
+        // the largest gaps in the Pareto front found so far are closed first (see "HypervolumeBound"). The coordinator
+        // of a distributed enumeration, which does not know about infeasible points of its workers, hands out elements
+        // as for SELECT_LARGEST_BOX_FIRST instead.
+        SELECT_LARGEST_GAP_FIRST
+    };
+
+    /**
+     * @brief The order in which the search for a Pareto point below a feasible co-Pareto element lowers the dimensions.
+     * The dimensions that come first can be lowered most, so the order decides which Pareto point is found, and with it
+     * the number of calls to the feasibility function of the search and of the rest of the run.
+     */
+    enum DimensionOrder {
+        // Always 0, 1, ..., nofDimensions-1
+        SEARCH_IN_INDEX_ORDER,
+        // Every search starts one dimension after the one that the previous search started with
+        SEARCH_ROTATING,
+        // The dimensions in which the co-Pareto element is farthest away from the lower limit come first
+        SEARCH_LARGEST_RANGE_FIRST,
+        // The dimensions whose searches needed the fewest calls to the feasibility function so far come first
+        SEARCH_ADAPTIVE
+    };
+
+    /**
+     * @brief How the search for a Pareto point finds the smallest feasible value in a dimension. Bisection always needs
+     * about log_2(range) calls to the feasibility function. Galloping probes values at distances 1, 2, 4, ... from one
+     * end of the range until it passes the smallest feasible value and then bisects the last step, so it needs about
+     * 2*log_2(distance) calls, where the distance is the one between that end and the smallest feasible value.
+     */
+    enum ValueSearch {
+        SEARCH_BY_BISECTION,
+        // From the value of the feasible co-Pareto element downwards
+        SEARCH_BY_GALLOPING_DOWN,
+        // From the lower limit upwards
+        SEARCH_BY_GALLOPING_UP,
+        // From the end of the range that the smallest feasible values of the earlier searches in the dimension were
+        // closer to
+        SEARCH_BY_GALLOPING_FROM_LIKELIER_END
+    };
+
+    /**
+     * @brief What the enumeration algorithm knows at some point of a run: the Pareto points found so far, the co-Pareto
+     * elements below which the remaining Pareto points are, and the minimal/maximal points known to be feasible/infeasible.
+     * For a run with "EnumerationOptions::approximationTolerance", the tolerances are recorded as well, as the points of
+     * its Pareto front are then only approximations. They are empty for an exact run.
+     */
+    struct EnumerationState {
+        std::vector<std::pair<int,int> > limits;
+        std::vector<int> approximationTolerance;
+        PointSet paretoFront;
+        PointSet coParetoElements;
+        PointSet negativePoints;
+        PointSet positivePoints;
+    };
+
+    /**
+     * @brief What is known before a run from outside of the enumeration, for example from a run before a small change
+     * of the model or from a heuristic (see "EnumerationOptions::warmStart")
+     */
+    struct WarmStart {
+        // Points that are likely to be Pareto points. Unless "trustParetoPoints" is true, the run evaluates the ones that
+        // are not dominated by others, and for every feasible one, it searches for a Pareto point below it by galloping
+        // downwards in every dimension. This costs 1+nofDimensions calls to the feasibility function for a point that is
+        // a Pareto point. Infeasible ones are dropped. With "trustParetoPoints", they are taken as Pareto points.
+        PointSet paretoPoints;
+        bool trustParetoPoints;
+
+        // Points that are known to be infeasible
+        PointSet negativePoints;
+
+        // If not empty, the run starts from these co-Pareto elements instead of the maximal point. Every Pareto point
+        // that is not in "paretoPoints" must be smaller than or equal to one of them.
+        PointSet coParetoElements;
+
+        WarmStart() : trustParetoPoints(false) {}
+    };
+
+    /**
+     * @brief Bounds on how much of the Pareto front a run has found so far, in terms of hypervolumes: the numbers of points
+     * within the limits that are pointwise greater than or equal to some Pareto point. The points that are neither
+     * dominated by the Pareto points found so far nor known to be infeasible are undecided, so the hypervolume of the
+     * whole Pareto front is between "dominatedVolume" and "dominatedVolume+undecidedVolume". The volumes are updated with
+     * every Pareto point and infeasible point that the run finds. A run that continues from a state or a warm start
+     * only knows about the Pareto points and infeasible points in it.
+     */
+    struct HypervolumeBound {
+        double totalVolume;
+        double dominatedVolume;
+        double undecidedVolume;
+
+        // A lower bound for the fraction of the hypervolume of the Pareto front that the Pareto points found so far
+        // dominate. It is 1 if there are no undecided points left.
+        double quality() const { return (undecidedVolume>0.0)?dominatedVolume/(dominatedVolume+undecidedVolume):1.0; }
+    };
+
+    /**
+     * @brief What an OracleCache does when it is full and a new result comes in
+     */
+    enum CacheEviction {
+        // The new result is not stored
+        EVICT_NOTHING,
+        // A result that has not been looked up since the last time that the search for a result to replace went past it
+        // is replaced (the "clock" approximation of replacing the least recently used result)
+        EVICT_CLOCK
+    };
+
+    /**
+     * @brief A cache for results of the feasibility function, for feasibility functions that are expensive enough that
+     * calls for points that have been evaluated before must be avoided. The enumeration algorithm itself only repeats a
+     * call if the search arity is greater than 1, but a cache can be shared by several runs with the same feasibility
+     * function, for example for different limits or after a crash (see "EnumerationOptions::oracleCache").
+     *
+     * The results are kept in a hash table with open addressing (linear probing) whose keys, the coordinates of the points,
+     * are stored one after the other in a single buffer.
+     */
+    class OracleCache {
+        size_t nofDimensions;
+        size_t maxNofEntries;
+        CacheEviction eviction;
+        size_t slotMask;
+        std::vector<int> keys; // nofDimensions coordinates per slot
+        std::vector<uint32_t> hashes;
+        std::vector<unsigned char> flags;
+        size_t nofEntries;
+        size_t clockHand;
+        size_t nofHitsSoFar;
+        size_t nofMissesSoFar;
+        size_t nofEvictionsSoFar;
+
+        uint32_t hash(const int *point) const;
+        bool find(const int *point, uint32_t pointHash, size_t &slot) const;
+        void erase(size_t slot);
+    public:
+        OracleCache(size_t nofDimensions, size_t capacity, CacheEviction eviction = EVICT_CLOCK);
+
+        // Writes the result for "point" to "result" if it is in the cache
+        bool lookup(const int *point, bool &result);
+        void insert(const int *point, bool result);
+        void clear();
+
+        size_t dimensions() const { return nofDimensions; }
+        size_t size() const { return nofEntries; }
+        size_t capacity() const { return maxNofEntries; }
+
+        // Statistics since the construction of the cache
+        size_t nofHits() const { return nofHitsSoFar; }
+        size_t nofMisses() const { return nofMissesSoFar; }
+        size_t nofEvictions() const { return nofEvictionsSoFar; }
+        double hitRate() const { return (nofHitsSoFar+nofMissesSoFar==0)?0.0:(double)nofHitsSoFar/(nofHitsSoFar+nofMissesSoFar); }
+    };
+
+    /**
+     * @brief Settings of the enumeration algorithm that most applications can leave at their default values
+     */
+    struct EnumerationOptions {
+        // The maximal number of points that are given to a batch feasibility function in one call, and the maximal
+        // number of calls to an asynchronous feasibility function that are pending at the same time
+        size_t maxBatchSize;
+
+        // The number of threads that evaluate a feasibility function for single points. With more than one thread,
+        // several co-Pareto elements are tested at the same time, and the feasibility function must be thread-safe.
+        unsigned int nofThreads;
+
+        // The number of values that are tested at once when searching for the smallest feasible value in a dimension
+        // below a feasible co-Pareto element. The search then needs about log_{searchArity+1}(range) rounds rather than
+        // log_2(range) of them, at the cost of more calls to the feasibility function, some of which are redundant.
+        // It is limited by the number of points that the feasibility function evaluates at once, so it only has an
+        // effect for batch and asynchronous feasibility functions and with "nofThreads" greater than 1. A value of 1
+        // means binary search.
+        unsigned int searchArity;
+
+        // How the smallest feasible value in a dimension is searched for. With galloping, every round tests the next
+        // "searchArity" distances.
+        ValueSearch valueSearch;
+
+        // The order in which the search for a Pareto point lowers the dimensions
+        DimensionOrder dimensionOrder;
+
+        // If not empty, the enumeration continues from the state stored in this file, provided that the file exists
+        // and was written for the same limits, and it writes its state to the file at the end and whenever at least
+        // "stateFileSaveInterval" seconds have passed since the last time. Runs with the same feasibility function can
+        // thus pick up the results of earlier runs and resume after a crash.
+        std::string stateFile;
+        double stateFileSaveInterval;
+
+        // If not NULL, the statistics of the run are written to this object. Without it, the enumeration does not
+        // collect any.
+        EnumerationStats *stats;
+
+        // If true, the co-Pareto elements and the result buffers store the coordinates with 16 or 8 bits, or with one bit
+        // for ranges of at most 1, whenever the ranges of the limits allow it. This makes them smaller and comparisons of
+        // points faster.
+        bool packCoordinates;
+
+        // The order in which the co-Pareto elements are tested. "selectionPriority" is only used with SELECT_BY_PRIORITY
+        // and called once for every co-Pareto element.
+        CoParetoSelection selection;
+        std::function<double(const std::vector<int> &)> selectionPriority;
+
+        // The run stops early when "stopToken" (if not NULL) becomes true, after "timeBudget" seconds, or after
+        // "oracleCallBudget" calls to the feasibility function. This is checked before every call to the feasibility
+        // function, so every budget is met up to the duration of one call, and the stop token can be set from another
+        // thread or from the feasibility function. The Pareto points found until then are returned as usual.
+        const std::atomic<bool> *stopToken;
+        double timeBudget;
+        size_t oracleCallBudget;
+
+        // If not NULL, the enumeration continues from "initialState", which must be for the same limits, rather than from a
+        // state file. If not NULL, "finalState" receives the state at the end of the run. A run has found all Pareto
+        // points if and only if the co-Pareto elements of its final state are empty. Otherwise, they show which parts of
+        // the space are unexplored, and the final state can be passed as initial state of a later run. With a Pareto point
+        // sink, the states contain neither the Pareto points nor other feasible points that are greater than or equal to
+        // them, so that no part of the run keeps the Pareto front in memory.
+        const EnumerationState *initialState;
+        EnumerationState *finalState;
+
+        // If not NULL, the results of the feasibility function are first looked up in "oracleCache", which must be for
+        // the same number of dimensions, and the new results are stored in it. Runs at the same time cannot share a cache.
+        OracleCache *oracleCache;
+
+        // If not NULL, a run that does not continue from an initial state or a state file starts from what
+        // "warmStart" knows. The set of co-Pareto elements is then built from all Pareto points at once.
+        const WarmStart *warmStart;
+
+        // If the co-Pareto elements and the result buffers take more than "memoryLimit" bytes, the co-Pareto elements
+        // that would be tested last are moved to a spill file, and so are the infeasible points that do not cover any of
+        // the remaining ones. The spilled co-Pareto elements are taken back when the others are done, which keeps the
+        // memory use near the limit at the cost of more work, and, as spilled infeasible points are only checked when
+        // co-Pareto elements are taken back, of some calls to the feasibility function whose results could have been
+        // inferred. The spill files are created in "spillDirectory", or in the directory for temporary files if it is
+        // empty, and they are deleted at the end of the run.
+        size_t memoryLimit;
+        std::string spillDirectory;
+
+        // If not empty, the run only computes an approximation of the Pareto front, with one tolerance per dimension. For
+        // every Pareto point p, the result then contains a feasible point that is smaller than or equal to p plus the
+        // tolerances. The search for a Pareto point stops lowering a dimension as soon as the smallest feasible value is
+        // known up to the tolerance, and a point that it finds also removes the part of the search space that is at most
+        // the tolerances below it, so that no point close to it is searched for later. A state of such a run can be
+        // turned into one for an exact run with "refineEnumerationState", which a run that continues from a state with
+        // other tolerances does by itself. The coordinator of a distributed enumeration needs the same tolerances as its
+        // workers, and it does not take states with other tolerances.
+        std::vector<int> approximationTolerance;
+
+        // If "hypervolumeProgress" is set, it is called with the bounds on the hypervolume of the Pareto front after every
+        // round of tests of co-Pareto elements and at the end of the run. If "hypervolumeTarget" is smaller than 1, the
+        // run stops early as soon as "HypervolumeBound::quality()" reaches it, which is checked like the budgets above.
+        // Keeping track of the bounds for either of them or for SELECT_LARGEST_GAP_FIRST takes two more sets of points of
+        // about the size of the set of co-Pareto elements, which are not subject to "memoryLimit".
+        std::function<void(const HypervolumeBound &)> hypervolumeProgress;
+        double hypervolumeTarget;
+
+        EnumerationOptions() : maxBatchSize(16), nofThreads(1), searchArity(1), valueSearch(SEARCH_BY_BISECTION), dimensionOrder(SEARCH_IN_INDEX_ORDER),
+            stateFileSaveInterval(60.0), stats(NULL), packCoordinates(true),
+            selection(SELECT_IN_INDEX_ORDER), stopToken(NULL), timeBudget(std::numeric_limits<double>::infinity()),
+            oracleCallBudget(std::numeric_limits<size_t>::max()), initialState(NULL), finalState(NULL), oracleCache(NULL), warmStart(NULL),
+            memoryLimit(std::numeric_limits<size_t>::max()), hypervolumeTarget(1.0) {}
+    };
+
+    // Functions for storing the enumeration state in a binary file. Loading returns false if the file does not exist.
+    // Both throw a "const char *" error message if something goes wrong.
+    void saveEnumerationState(const std::string &filename, const EnumerationState &state);
+    bool loadEnumerationState(const std::string &filename, EnumerationState &state);
+
+    // Functions for turning an enumeration state into a compact string of bytes and back, for example for sending it to
+    // another machine. The coordinates are stored as variable-length differences to the previous point of the same set,
+    // so the strings do not depend on the byte order. Decoding throws a "const char *" error message if the string is
+    // malformed.
+    std::string encodeEnumerationState(const EnumerationState &state);
+    void decodeEnumerationState(const std::string &data, EnumerationState &state);
+
+    // Turns the state of a run with "EnumerationOptions::approximationTolerance" into one from which an exact run finds
+    // all Pareto points. The results of the feasibility function are kept, and only the parts of the search space that
+    // the approximation skipped are left as co-Pareto elements. The points of the approximation are not Pareto points
+    // of the exact state, but the exact run finds the Pareto points below them.
+    void refineEnumerationState(const EnumerationState &approximate, EnumerationState &exact);
+
+    namespace detail {
+        class CoordinatorData;
+    }
+
+    /**
+     * @brief The coordinator of an enumeration that is distributed over several workers, for example on the machines of
+     * a cluster. How the work units and results get from the coordinator to the workers and back is up to the
+     * application. "encodeEnumerationState" and "decodeEnumerationState" give them a compact format.
+     *
+     * A work unit is an enumeration state with some of the co-Pareto elements of the coordinator and the known feasible
+     * and infeasible points below them. A worker runs the enumeration on it with "enumerateWorkUnit", possibly with a
+     * budget, and the final state of that run is its result. The coordinator merges the results: the new Pareto points
+     * split the co-Pareto elements of all other work units and of the coordinator itself, and the co-Pareto elements
+     * that are left in a result go back to the coordinator. Since the regions below the co-Pareto elements of
+     * different work units overlap, several workers can find the same Pareto point, but the coordinator keeps it once.
+     *
+     * The coordinator is not thread-safe.
+     */
+    class EnumerationCoordinator {
+        std::unique_ptr<detail::CoordinatorData> data;
+    public:
+        // The options decide in which order the co-Pareto elements are handed out ("selection" and "selectionPriority")
+        // and whether the coordinator stores points with packed coordinates. The other ones are for the workers.
+        EnumerationCoordinator(const std::vector<std::pair<int,int> > &limits, const EnumerationOptions &options = EnumerationOptions());
+        // Continues from the state of an earlier enumeration, for example one from "getState"
+        EnumerationCoordinator(const EnumerationState &state, const EnumerationOptions &options = EnumerationOptions());
+        ~EnumerationCoordinator();
+
+        // Hands out up to "maxNofCoParetoElements" co-Pareto elements as a new work unit. Returns false if no co-Pareto
+        // element is left, which means that the enumeration is finished unless some work units are still open.
+        bool getWorkUnit(size_t maxNofCoParetoElements, size_t &workUnitId, EnumerationState &workUnit);
+
+        // Merges the result of an open work unit. Its Pareto points are the ones that the worker found.
+        void addResult(size_t workUnitId, const EnumerationState &result);
+
+        // Takes back the co-Pareto elements of an open work unit without a result, for example when a worker failed
+        void returnWorkUnit(size_t workUnitId);
+
+        size_t nofOpenWorkUnits() const;
+        bool isFinished() const;
+        const PointSet &getParetoFront() const;
+
+        // Writes what the coordinator knows to "state", with the co-Pareto elements of the open work units as if they had
+        // been returned. A new coordinator or an ordinary run of the enumeration can continue from it.
+        void getState(EnumerationState &state) const;
+    };
+
+    // Runs the enumeration on a work unit of an EnumerationCoordinator and writes the final state to "result", which
+    // gets the Pareto points found in the run. The budgets in "options" make work units shorter.
+    template<class F> void enumerateWorkUnit(F &&fn, const EnumerationState &workUnit, EnumerationState &result, const EnumerationOptions &options = EnumerationOptions());
+
     // Main function
-    std::list<std::vector<int> > enumerateParetoFront(std::function<bool(const std::vector<int> &)> fn, const std::vector<std::pair<int,int> > &limits);
+    std::list<std::vector<int> > enumerateParetoFront(std::function<bool(const std::vector<int> &)> fn, const std::vector<std::pair<int,int> > &limits, const EnumerationOptions &options = EnumerationOptions());
+
+    // Variant of the main function that stores the Pareto front in a PointSet
+    void enumerateParetoFront(std::function<bool(const std::vector<int> &)> fn, const std::vector<std::pair<int,int> > &limits, PointSet &paretoFront, const EnumerationOptions &options = EnumerationOptions());
+
+    // Variant of the main function that passes every Pareto point to "paretoPointSink" as soon as it is found rather
+    // than keeping the Pareto front in memory
+    void enumerateParetoFront(std::function<bool(const std::vector<int> &)> fn, const std::vector<std::pair<int,int> > &limits, const std::function<void(const std::vector<int> &)> &paretoPointSink, const EnumerationOptions &options = EnumerationOptions());
+
+    // Variants of the main function for feasibility functions that evaluate several points at once
+    std::list<std::vector<int> > enumerateParetoFront(std::function<std::vector<bool>(const PointBatch &)> fn, const std::vector<std::pair<int,int> > &limits, const EnumerationOptions &options = EnumerationOptions());
+    void enumerateParetoFront(std::function<std::vector<bool>(const PointBatch &)> fn, const std::vector<std::pair<int,int> > &limits, PointSet &paretoFront, const EnumerationOptions &options = EnumerationOptions());
+    void enumerateParetoFront(std::function<std::vector<bool>(const PointBatch &)> fn, const std::vector<std::pair<int,int> > &limits, const std::function<void(const std::vector<int> &)> &paretoPointSink, const EnumerationOptions &options = EnumerationOptions());
+
+    // Variants of the main function for asynchronous feasibility functions, which start the evaluation of a point and
+    // return a future for the result. Up to "options.maxBatchSize" calls are pending at the same time.
+    std::list<std::vector<int> > enumerateParetoFront(std::function<std::future<bool>(const std::vector<int> &)> fn, const std::vector<std::pair<int,int> > &limits, const EnumerationOptions &options = EnumerationOptions());
+    void enumerateParetoFront(std::function<std::future<bool>(const std::vector<int> &)> fn, const std::vector<std::pair<int,int> > &limits, PointSet &paretoFront, const EnumerationOptions &options = EnumerationOptions());
+    void enumerateParetoFront(std::function<std::future<bool>(const std::vector<int> &)> fn, const std::vector<std::pair<int,int> > &limits, const std::function<void(const std::vector<int> &)> &paretoPointSink, const EnumerationOptions &options = EnumerationOptions());
+
+    // Template variants of the main function, which allow the compiler to inline calls to the feasibility function "fn".
+    // It can take single points (as "const std::vector<int> &") or batches of points (as "const PointBatch &"), and it
+    // can return the result for a single point as a future, i.e., an object whose member function "get" waits for it.
+    // They compile the generic enumerator once per type of "fn". Only the variants above have enumerators for a fixed
+    // number of 3 to 6 dimensions as well, in which the loops over the dimensions have a trip count known at compile time.
+    // Runs with "EnumerationOptions::stats" call "fn" through the variants above instead, unless
+    // PARETO_ENUMERATOR_INLINE_STATS is defined in all translation units, which compiles the enumerator with the code for
+    // collecting statistics for every type of "fn" as well.
+    template<class F> std::list<std::vector<int> > enumerateParetoFront(F &&fn, const std::vector<std::pair<int,int> > &limits, const EnumerationOptions &options = EnumerationOptions());
+    template<class F> void enumerateParetoFront(F &&fn, const std::vector<std::pair<int,int> > &limits, PointSet &paretoFront, const EnumerationOptions &options = EnumerationOptions());
+    template<class F> void enumerateParetoFront(F &&fn, const std::vector<std::pair<int,int> > &limits, const std::function<void(const std::vector<int> &)> &paretoPointSink, const EnumerationOptions &options = EnumerationOptions());
 
     // Additional functions that will remain stable and may be useful for some applications
     std::list<std::vector<int> > cleanParetoFront(const std::list<std::vector<int> > &input);
+    PointSet cleanParetoFront(const PointSet &input);
+
+    // Variants of cleanParetoFront that run on "nofThreads" threads, including the calling one
+    std::list<std::vector<int> > cleanParetoFront(const std::list<std::vector<int> > &input, unsigned int nofThreads);
+    PointSet cleanParetoFront(const PointSet &input, unsigned int nofThreads);
 }
 
+#include "pareto_enumerator_impl.hpp"
+
 #endif
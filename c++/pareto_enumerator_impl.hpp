@@ -0,0 +1,2496 @@
+#ifndef PARETO_ENUMERATOR_IMPL_HPP__
+#define PARETO_ENUMERATOR_IMPL_HPP__
+
+
+/*
+ * This is
+ *   pareto_enumerator_impl.hpp
+ * that is part of the ParetoFrontEnumerationAlgorithm library, available from
+ *   https://github.com/progirep/ParetoFrontEnumerationAlgorithm
+ *
+ * Is ia a library for enumerating all elements of a Pareto front for a
+ * multi-criterial optimization problem for which all optimization objectives
+ * have a finite range.
+ *
+ * The library and all of its files are distributed under the following license:
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Ruediger Ehlers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// The implementation of the enumeration algorithm. It is included by "pareto_enumerator.hpp" and is not meant to be
+// included on its own. As the feasibility function is a template parameter of the main function, the algorithm needs
+// to be in a header.
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace paretoenumerator {
+
+namespace detail {
+
+    inline bool pointIsSmaller(const int *a, const int *b, size_t size) {
+        for (size_t i = 0;i<size;i++) {
+            if (b[i]<a[i]) return false;
+            if (b[i]!=a[i]) {
+                // We continue the outer loop now here as this is
+                // faster than storing whether a smaller
+                // element has been found in a flag.
+                for (i++;i<size;i++) {
+                    if (b[i]<a[i]) return false;
+                }
+                return true;
+            }
+        }
+        return false;
+    }
+
+    inline bool pointIsLeq(const int *a, const int *b, size_t size) {
+        for (size_t i = 0;i<size;i++) {
+            if (b[i]<a[i]) return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Sorts "points" lexicographically and keeps only one copy of points that occur several times
+     */
+    inline void sortPointsAndRemoveDuplicates(PointSet &points) {
+        const size_t nofDimensions = points.dimensions();
+        std::vector<size_t> order(points.size());
+        for (size_t i=0;i<order.size();i++) order[i] = i;
+        std::sort(order.begin(),order.end(),[&points,nofDimensions](size_t a, size_t b) {
+            return std::lexicographical_compare(points[a],points[a]+nofDimensions,points[b],points[b]+nofDimensions);
+        });
+        order.erase(std::unique(order.begin(),order.end(),[&points,nofDimensions](size_t a, size_t b) {
+            return std::equal(points[a],points[a]+nofDimensions,points[b]);
+        }),order.end());
+        PointSet sorted(nofDimensions);
+        sorted.reserve(order.size());
+        for (size_t i : order) sorted.push_back(points[i]);
+        points.swap(sorted);
+    }
+
+    /**
+     * @brief Writes the points of "input" that are not smaller than another one to "maximalPoints", with a single call to
+     * "cleanParetoFront" rather than one dominance check per point. Points that occur several times in "input" are
+     * written once, so that the result can be inserted into a point index.
+     */
+    inline void getMaximalPoints(const PointSet &input, PointSet &maximalPoints) {
+        PointSet negated(input.dimensions());
+        negated.append(input.coordinates().data(),input.size());
+        for (size_t i=0;i<negated.size();i++) {
+            for (size_t d=0;d<negated.dimensions();d++) negated[i][d] = -negated[i][d];
+        }
+        maximalPoints = cleanParetoFront(negated);
+        for (size_t i=0;i<maximalPoints.size();i++) {
+            for (size_t d=0;d<maximalPoints.dimensions();d++) maximalPoints[i][d] = -maximalPoints[i][d];
+        }
+        sortPointsAndRemoveDuplicates(maximalPoints);
+    }
+
+    /**
+     * @brief The number of dimensions that the data structures below work with. For N>0, it is fixed at compile time, so
+     * that the compiler can unroll loops over the dimensions. For N=0, it is stored at runtime.
+     */
+    template<size_t N> class Dimensions {
+    public:
+        Dimensions(size_t) {}
+        operator size_t() const { return N; }
+    };
+
+    template<> class Dimensions<0> {
+        size_t value;
+    public:
+        Dimensions(size_t _value) : value(_value) {}
+        operator size_t() const { return value; }
+    };
+
+    /**
+     * @brief The type of single points for N dimensions: a std::array<int,N> for N>0 and a std::vector<int> otherwise
+     */
+    template<size_t N> struct PointStorage {
+        typedef std::array<int,N> Point;
+        static Point make(size_t) { return Point(); }
+    };
+
+    template<> struct PointStorage<0> {
+        typedef std::vector<int> Point;
+        static Point make(size_t nofDimensions) { return Point(nofDimensions); }
+    };
+
+
+    //=============================================================================================================
+    // Kernels that compare a point against a block of up to 64 points. The points in a block are stored column by
+    // column, i.e., the first "blockCapacity" entries are the values of all points in the first dimension, etc. The kernels
+    // themselves are in "pareto_enumerator.cpp".
+    //=============================================================================================================
+    const size_t blockCapacity = 64;
+
+    /**
+     * @brief Signature of the block comparison kernels. Bit i of the result is set if bit i of "mask" is set and the
+     * i-th point in the block is pointwise greater than or equal to (or, for the "leq" kernels, smaller than or equal to)
+     * "point". All slots of the block are read, even those that are not in "mask". The kernels for N>0 dimensions (see
+     * below) expect "nofDimensions" to be N.
+     */
+    typedef uint64_t (*BlockKernel)(const int *block, const int *point, size_t nofDimensions, uint64_t mask);
+
+    struct BlockKernels {
+        BlockKernel geq;
+        BlockKernel leq;
+    };
+
+    /**
+     * @brief Returns the fastest block comparison kernels that the CPU supports. They are selected on the first call.
+     * "N" is the number of dimensions, or 0 for kernels that take it at run time. "pareto_enumerator.cpp" compiles the
+     * kernels for 0 and 3 to 6 dimensions, which are the numbers of dimensions of the enumerators in "runEnumerator".
+     */
+    template<size_t N> const BlockKernels &getBlockKernels();
+
+    /**
+     * @brief Signature of the block comparison kernels for packed coordinates. Then, every column of a block consists
+     * of "bitsPerCoordinate" 64-bit words (see "getPackedValue"), and the coordinates of "point" must be packed values
+     * as well. The result is the same as for the kernels above.
+     */
+    typedef uint64_t (*PackedBlockKernel)(const uint64_t *block, const int *point, size_t nofDimensions, uint64_t mask);
+
+    struct PackedBlockKernels {
+        PackedBlockKernel geq;
+        PackedBlockKernel leq;
+    };
+
+    /**
+     * @brief Returns the fastest kernels for 1, 8, or 16 bits per coordinate that the CPU supports
+     */
+    template<size_t N> const PackedBlockKernels &getPackedBlockKernels(unsigned int bitsPerCoordinate);
+
+    /**
+     * @brief Return all kernels that are compiled in and that the CPU supports, starting with the portable ones, so that
+     * they can be tested against each other
+     */
+    template<size_t N> std::vector<BlockKernels> getSupportedBlockKernels();
+    template<size_t N> std::vector<PackedBlockKernels> getSupportedPackedBlockKernels(unsigned int bitsPerCoordinate);
+
+    /**
+     * @brief Reads slot "slot" of a column of packed values. The slots are stored one after the other, starting at the lowest
+     * bits of the first word, so that for 8 or 16 bits per coordinate, a column is an array of uint8_t or uint16_t elements
+     * on little-endian machines.
+     */
+    inline int getPackedValue(const uint64_t *column, size_t slot, unsigned int bitsPerCoordinate) {
+        const size_t bit = slot*bitsPerCoordinate;
+        return int((column[bit/64] >> (bit%64)) & ((uint64_t(1) << bitsPerCoordinate)-1));
+    }
+
+    inline void setPackedValue(uint64_t *column, size_t slot, unsigned int bitsPerCoordinate, int value) {
+        const size_t bit = slot*bitsPerCoordinate;
+        const uint64_t valueMask = ((uint64_t(1) << bitsPerCoordinate)-1) << (bit%64);
+        column[bit/64] = (column[bit/64] & ~valueMask) | (uint64_t(value) << (bit%64));
+    }
+
+    /**
+     * @brief The smallest number of bits per coordinate (1, 8, 16, or 32 for unpacked values) that can store all points within
+     * the limits if the lower limits are subtracted from the coordinates
+     */
+    inline unsigned int bitsPerCoordinateFor(const std::vector<std::pair<int,int> > &limits) {
+        long long largestRange = 0;
+        for (auto const &limit : limits) largestRange = std::max(largestRange,(long long)limit.second-limit.first);
+        if (largestRange<=1) return 1;
+        if (largestRange<=0xFF) return 8;
+        if (largestRange<=0xFFFF) return 16;
+        return 32;
+    }
+
+    inline uint64_t maskOfFirstElements(size_t nofElements) {
+        return (nofElements>=blockCapacity)?~uint64_t(0):((uint64_t(1) << nofElements)-1);
+    }
+
+    inline unsigned int indexOfLowestBit(uint64_t mask) {
+#if defined(__GNUC__)
+        return __builtin_ctzll(mask);
+#else
+        unsigned int index = 0;
+        while ((mask & 1)==0) {
+            mask >>= 1;
+            index++;
+        }
+        return index;
+#endif
+    }
+
+
+
+    /**
+     * @brief A bucket k-d tree over points of a fixed dimension. It answers whether one of the stored points is
+     * pointwise greater than or equal to a query point, and it removes all stored points that are pointwise
+     * smaller than or equal to some point.
+     *
+     * Leaves store up to "blockCapacity" points in a column-major block, so that checking all points of a leaf
+     * against a query only needs to touch one contiguous memory region. Every node keeps the bounding box of the
+     * points below it, which allows to skip or to accept/remove whole sub-trees at once.
+     *
+     * Inserting points in sorted order, which the enumeration algorithm tends to do, would make the tree degenerate.
+     * Hence, a sub-tree is rebuilt in balanced form when one of its children holds more than three quarters of its
+     * points and it has at least doubled in size since it was built, so that rebuilding takes amortized logarithmic time.
+     *
+     * If the index is built for limits whose ranges are small, the lower limits are subtracted from the coordinates and
+     * the blocks store them with 16 or 8 bits, or bit-sliced for ranges of at most 1 (see "bitsPerCoordinateFor"). Apart
+     * from the blocks, the index then works with these packed values throughout, including the bounding boxes and the split
+     * values. Points are packed and unpacked in the public functions.
+     */
+    template<size_t N> class PointIndex {
+        struct Node {
+            size_t nofPoints;
+            size_t nofPointsWhenBuilt; // Only used by inner nodes
+            size_t children[2]; // Only used by inner nodes. Points with "splitValue" or less go to the first child
+            size_t block; // Only used by leaves
+            size_t splitDimension;
+            int splitValue;
+            bool isLeaf;
+        };
+
+        const Dimensions<N> nofDimensions;
+        std::vector<Node> nodes; // The root is node 0
+        std::vector<int> boxes; // For every node: lower bounds, followed by upper bounds
+        const unsigned int bitsPerCoordinate; // 32 for unpacked values
+        const size_t wordsPerPackedColumn;
+        std::vector<int> blocks; // For every block: one column of "blockCapacity" entries per dimension. Unpacked values only.
+        std::vector<uint64_t> packedBlocks; // For every block: one column of "wordsPerPackedColumn" words per dimension
+        typename PointStorage<N>::Point offsets; // Subtracted from the coordinates before packing them
+        typename PointStorage<N>::Point packedPoint;
+        std::vector<size_t> freeNodes;
+        std::vector<size_t> freeBlocks;
+        size_t nofBlocks;
+        std::vector<int> pointBuffer;
+        PointSet rebuildPoints;
+        std::vector<size_t> rebuildOrder;
+        const BlockKernels kernels;
+        const PackedBlockKernels packedKernels;
+
+        int *lowerBounds(size_t node) { return &(boxes[node*2*nofDimensions]); }
+        int *upperBounds(size_t node) { return &(boxes[(node*2+1)*nofDimensions]); }
+
+        int value(size_t block, size_t dimension, size_t slot) const {
+            if (bitsPerCoordinate==32) return blocks[(block*nofDimensions+dimension)*blockCapacity+slot];
+            return getPackedValue(&(packedBlocks[(block*nofDimensions+dimension)*wordsPerPackedColumn]),slot,bitsPerCoordinate);
+        }
+
+        void setValue(size_t block, size_t dimension, size_t slot, int newValue) {
+            if (bitsPerCoordinate==32) {
+                blocks[(block*nofDimensions+dimension)*blockCapacity+slot] = newValue;
+            } else {
+                setPackedValue(&(packedBlocks[(block*nofDimensions+dimension)*wordsPerPackedColumn]),slot,bitsPerCoordinate,newValue);
+            }
+        }
+
+        void copyPoint(size_t block, size_t slot, int *out) const {
+            for (size_t d=0;d<nofDimensions;d++) out[d] = value(block,d,slot);
+        }
+
+        size_t newBlock() {
+            if (!freeBlocks.empty()) {
+                size_t block = freeBlocks.back();
+                freeBlocks.pop_back();
+                return block;
+            }
+            if (bitsPerCoordinate==32) {
+                blocks.resize(blocks.size()+blockCapacity*nofDimensions);
+            } else {
+                packedBlocks.resize(packedBlocks.size()+wordsPerPackedColumn*nofDimensions);
+            }
+            return nofBlocks++;
+        }
+
+        /**
+         * @brief Packs a point, or returns NULL if it is outside of the limits
+         */
+        const int *packWithinLimits(const int *point) {
+            if (bitsPerCoordinate==32) return point;
+            const long long maxValue = (1LL << bitsPerCoordinate)-1;
+            for (size_t d=0;d<nofDimensions;d++) {
+                const long long packed = (long long)point[d]-offsets[d];
+                if ((packed<0) || (packed>maxValue)) return NULL;
+                packedPoint[d] = (int)packed;
+            }
+            return packedPoint.data();
+        }
+
+        /**
+         * @brief Packs a point that is to be inserted into the index
+         */
+        const int *pack(const int *point) {
+            const int *packed = packWithinLimits(point);
+            if (packed==NULL) throw "Error: A point outside of the limits was added to a point index.";
+            return packed;
+        }
+
+        /**
+         * @brief Packs a query point. As the stored points are within the limits, coordinates outside of the limits can be
+         * moved to the nearest limit unless this changes the answer, in which case no stored point can match and NULL is
+         * returned.
+         */
+        template<bool above> const int *packQuery(const int *point) {
+            if (bitsPerCoordinate==32) return point;
+            const long long maxValue = (1LL << bitsPerCoordinate)-1;
+            for (size_t d=0;d<nofDimensions;d++) {
+                const long long packed = (long long)point[d]-offsets[d];
+                if (above?(packed>maxValue):(packed<0)) return NULL;
+                packedPoint[d] = (int)std::min(std::max(packed,0LL),maxValue);
+            }
+            return packedPoint.data();
+        }
+
+        void unpack(int *point) const {
+            if (bitsPerCoordinate==32) return;
+            for (size_t d=0;d<nofDimensions;d++) point[d] += offsets[d];
+        }
+
+        void unpackPoints(PointSet &points, size_t first) const {
+            for (size_t i=first;i<points.size();i++) unpack(points[i]);
+        }
+
+        /**
+         * @brief Allocates an empty leaf. The caller has to assign a block to it.
+         */
+        size_t newNode() {
+            size_t node;
+            if (!freeNodes.empty()) {
+                node = freeNodes.back();
+                freeNodes.pop_back();
+            } else {
+                node = nodes.size();
+                nodes.push_back(Node());
+                boxes.resize(boxes.size()+2*nofDimensions);
+            }
+            nodes[node].nofPoints = 0;
+            nodes[node].isLeaf = true;
+            return node;
+        }
+
+        void freeSubtree(size_t node) {
+            if (nodes[node].isLeaf) {
+                freeBlocks.push_back(nodes[node].block);
+            } else {
+                freeSubtree(nodes[node].children[0]);
+                freeSubtree(nodes[node].children[1]);
+            }
+            freeNodes.push_back(node);
+        }
+
+        void makeEmptyLeaf(size_t node) {
+            if (!nodes[node].isLeaf) {
+                freeSubtree(nodes[node].children[0]);
+                freeSubtree(nodes[node].children[1]);
+                nodes[node].isLeaf = true;
+                nodes[node].block = newBlock();
+            }
+            nodes[node].nofPoints = 0;
+        }
+
+        /**
+         * @brief Computes which points of a leaf are greater than or equal to (if "above" is true) or smaller
+         * than or equal to (otherwise) the given point.
+         * @return a bit mask with one bit for each point in the leaf
+         */
+        template<bool above> uint64_t leafMask(size_t node, const int *point) {
+            const size_t block = nodes[node].block;
+            const uint64_t mask = maskOfFirstElements(nodes[node].nofPoints);
+            if (bitsPerCoordinate==32) return (above?kernels.geq:kernels.leq)(&(blocks[block*blockCapacity*nofDimensions]),point,nofDimensions,mask);
+            return (above?packedKernels.geq:packedKernels.leq)(&(packedBlocks[block*wordsPerPackedColumn*nofDimensions]),point,nofDimensions,mask);
+        }
+
+        void recomputeLeafBox(size_t node) {
+            const size_t nofPoints = nodes[node].nofPoints;
+            const size_t block = nodes[node].block;
+            int *lower = lowerBounds(node);
+            int *upper = upperBounds(node);
+            for (size_t d=0;d<nofDimensions;d++) {
+                lower[d] = value(block,d,0);
+                upper[d] = lower[d];
+                for (size_t i=1;i<nofPoints;i++) {
+                    const int v = value(block,d,i);
+                    if (v<lower[d]) lower[d] = v;
+                    if (v>upper[d]) upper[d] = v;
+                }
+            }
+        }
+
+        template<bool above, bool count> bool containsRecurse(size_t node, const int *point, size_t &nofVisitedNodes) {
+            if (count) nofVisitedNodes++;
+            if (nodes[node].nofPoints==0) return false;
+            const int *lower = lowerBounds(node);
+            const int *upper = upperBounds(node);
+            bool allMatch = true;
+            for (size_t d=0;d<nofDimensions;d++) {
+                if (above?(upper[d]<point[d]):(lower[d]>point[d])) return false;
+                allMatch &= above?(lower[d]>=point[d]):(upper[d]<=point[d]);
+            }
+            if (allMatch) return true;
+            if (nodes[node].isLeaf) return leafMask<above>(node,point)!=0;
+            return containsRecurse<above,count>(nodes[node].children[0],point,nofVisitedNodes) || containsRecurse<above,count>(nodes[node].children[1],point,nofVisitedNodes);
+        }
+
+        /**
+         * @brief Appends all points below a node to "out".
+         */
+        void collectSubtree(size_t node, PointSet &out) {
+            if (nodes[node].isLeaf) {
+                for (size_t i=0;i<nodes[node].nofPoints;i++) {
+                    copyPoint(nodes[node].block,i,pointBuffer.data());
+                    out.push_back(pointBuffer);
+                }
+            } else {
+                collectSubtree(nodes[node].children[0],out);
+                collectSubtree(nodes[node].children[1],out);
+            }
+        }
+
+        template<bool above> void collectRecurse(size_t node, const int *point, PointSet &out) {
+            if (nodes[node].nofPoints==0) return;
+            const int *lower = lowerBounds(node);
+            const int *upper = upperBounds(node);
+            bool allMatch = true;
+            for (size_t d=0;d<nofDimensions;d++) {
+                if (above?(upper[d]<point[d]):(lower[d]>point[d])) return;
+                allMatch &= above?(lower[d]>=point[d]):(upper[d]<=point[d]);
+            }
+            if (allMatch) {
+                collectSubtree(node,out);
+            } else if (nodes[node].isLeaf) {
+                for (uint64_t mask = leafMask<above>(node,point);mask!=0;mask &= mask-1) {
+                    copyPoint(nodes[node].block,indexOfLowestBit(mask),pointBuffer.data());
+                    out.push_back(pointBuffer);
+                }
+            } else {
+                collectRecurse<above>(nodes[node].children[0],point,out);
+                collectRecurse<above>(nodes[node].children[1],point,out);
+            }
+        }
+
+        /**
+         * @brief Removes the points in a leaf that are marked in a bit mask. They are appended to "out" if it is not NULL.
+         */
+        void removeFromLeaf(size_t node, uint64_t mask, PointSet *out) {
+            // Fill the gaps with the last points in the block
+            const size_t block = nodes[node].block;
+            size_t nofPoints = nodes[node].nofPoints;
+            for (size_t i=nofPoints;i>0;i--) {
+                if (mask & (uint64_t(1) << (i-1))) {
+                    if (out!=NULL) {
+                        copyPoint(block,i-1,pointBuffer.data());
+                        out->push_back(pointBuffer);
+                    }
+                    nofPoints--;
+                    for (size_t d=0;d<nofDimensions;d++) {
+                        setValue(block,d,i-1,value(block,d,nofPoints));
+                    }
+                }
+            }
+            nodes[node].nofPoints = nofPoints;
+            if (nofPoints>0) recomputeLeafBox(node);
+        }
+
+        template<bool above> void removeRecurse(size_t node, const int *point, PointSet *out) {
+            if (nodes[node].nofPoints==0) return;
+            const int *lower = lowerBounds(node);
+            const int *upper = upperBounds(node);
+            bool allMatch = true;
+            for (size_t d=0;d<nofDimensions;d++) {
+                if (above?(upper[d]<point[d]):(lower[d]>point[d])) return;
+                allMatch &= above?(lower[d]>=point[d]):(upper[d]<=point[d]);
+            }
+            if (allMatch) {
+                if (out!=NULL) collectSubtree(node,*out);
+                makeEmptyLeaf(node);
+                return;
+            }
+
+            if (nodes[node].isLeaf) {
+                uint64_t mask = leafMask<above>(node,point);
+                if (mask!=0) removeFromLeaf(node,mask,out);
+                return;
+            }
+
+            removeRecurse<above>(nodes[node].children[0],point,out);
+            removeRecurse<above>(nodes[node].children[1],point,out);
+            updateInnerNode(node);
+        }
+
+        bool removeOneRecurse(size_t node, const int *point) {
+            if (nodes[node].nofPoints==0) return false;
+            const int *lower = lowerBounds(node);
+            const int *upper = upperBounds(node);
+            for (size_t d=0;d<nofDimensions;d++) {
+                if ((point[d]<lower[d]) || (point[d]>upper[d])) return false;
+            }
+            if (nodes[node].isLeaf) {
+                uint64_t mask = leafMask<true>(node,point) & leafMask<false>(node,point);
+                if (mask==0) return false;
+                removeFromLeaf(node,mask & (~mask+1),NULL);
+                return true;
+            }
+            if (!removeOneRecurse(nodes[node].children[0],point) && !removeOneRecurse(nodes[node].children[1],point)) return false;
+            updateInnerNode(node);
+            return true;
+        }
+
+        void popRecurse(size_t node, int *out) {
+            if (nodes[node].isLeaf) {
+                const size_t last = nodes[node].nofPoints-1;
+                copyPoint(nodes[node].block,last,out);
+                nodes[node].nofPoints = last;
+                if (last>0) recomputeLeafBox(node);
+            } else {
+                popRecurse(nodes[node].children[1],out);
+                updateInnerNode(node);
+            }
+        }
+
+        /**
+         * @brief Recomputes the number of points and the bounding box of an inner node after points have been removed
+         * from its children, and collapses the node if one of its children became empty. Since the children have been
+         * updated before, empty children are always leaves.
+         */
+        void updateInnerNode(size_t node) {
+            size_t children[2] = {nodes[node].children[0],nodes[node].children[1]};
+            if (nodes[children[0]].nofPoints==0) {
+                if (nodes[children[1]].nofPoints==0) {
+                    nodes[node].isLeaf = true;
+                    nodes[node].block = nodes[children[0]].block;
+                    nodes[node].nofPoints = 0;
+                    freeBlocks.push_back(nodes[children[1]].block);
+                    freeNodes.push_back(children[0]);
+                    freeNodes.push_back(children[1]);
+                } else {
+                    promoteChild(node,children[1],children[0]);
+                }
+            } else if (nodes[children[1]].nofPoints==0) {
+                promoteChild(node,children[0],children[1]);
+            } else {
+                nodes[node].nofPoints = nodes[children[0]].nofPoints + nodes[children[1]].nofPoints;
+                int *lowerMod = lowerBounds(node);
+                int *upperMod = upperBounds(node);
+                const int *lower0 = lowerBounds(children[0]);
+                const int *upper0 = upperBounds(children[0]);
+                const int *lower1 = lowerBounds(children[1]);
+                const int *upper1 = upperBounds(children[1]);
+                for (size_t d=0;d<nofDimensions;d++) {
+                    lowerMod[d] = std::min(lower0[d],lower1[d]);
+                    upperMod[d] = std::max(upper0[d],upper1[d]);
+                }
+            }
+        }
+
+        /**
+         * @brief Replaces an inner node by its child "keep". The other child must be an empty leaf.
+         */
+        void promoteChild(size_t node, size_t keep, size_t emptyLeaf) {
+            freeBlocks.push_back(nodes[emptyLeaf].block);
+            freeNodes.push_back(emptyLeaf);
+            nodes[node] = nodes[keep];
+            std::copy(lowerBounds(keep),lowerBounds(keep)+2*nofDimensions,lowerBounds(node));
+            freeNodes.push_back(keep);
+        }
+
+        /**
+         * @brief Splits a full leaf along the dimension in which its points have the largest spread.
+         */
+        void splitLeaf(size_t node) {
+            const int *lower = lowerBounds(node);
+            const int *upper = upperBounds(node);
+            size_t splitDimension = 0;
+            for (size_t d=1;d<nofDimensions;d++) {
+                if (((long long)upper[d]-lower[d])>((long long)upper[splitDimension]-lower[splitDimension])) splitDimension = d;
+            }
+
+            // Find the median value in the split dimension. Points with a value of at most the median go
+            // to the left, so if the median is the maximal value, the next smaller value is taken instead.
+            const size_t nofPoints = nodes[node].nofPoints;
+            const size_t oldBlock = nodes[node].block;
+            const int maxValue = upper[splitDimension];
+            int values[blockCapacity] = {};
+            for (size_t i=0;i<nofPoints;i++) values[i] = value(oldBlock,splitDimension,i);
+            std::nth_element(values,values+nofPoints/2,values+nofPoints);
+            int splitValue = values[nofPoints/2];
+            if (splitValue==maxValue) {
+                if (lower[splitDimension]==maxValue) return; // All points are the same
+                splitValue = lower[splitDimension];
+                for (size_t i=0;i<nofPoints;i++) {
+                    if ((values[i]<maxValue) && (values[i]>splitValue)) splitValue = values[i];
+                }
+            }
+
+            // Distribute the points. The left child inherits the block of this node.
+            size_t left = newNode();
+            nodes[left].block = oldBlock;
+            size_t right = newNode();
+            const size_t rightBlock = newBlock();
+            nodes[right].block = rightBlock;
+            size_t nofLeft = 0;
+            size_t nofRight = 0;
+            for (size_t i=0;i<nofPoints;i++) {
+                if (value(oldBlock,splitDimension,i)<=splitValue) {
+                    for (size_t d=0;d<nofDimensions;d++) setValue(oldBlock,d,nofLeft,value(oldBlock,d,i));
+                    nofLeft++;
+                } else {
+                    for (size_t d=0;d<nofDimensions;d++) setValue(rightBlock,d,nofRight,value(oldBlock,d,i));
+                    nofRight++;
+                }
+            }
+            nodes[left].nofPoints = nofLeft;
+            nodes[right].nofPoints = nofRight;
+            recomputeLeafBox(left);
+            recomputeLeafBox(right);
+
+            nodes[node].isLeaf = false;
+            nodes[node].nofPointsWhenBuilt = nofPoints;
+            nodes[node].splitDimension = splitDimension;
+            nodes[node].splitValue = splitValue;
+            nodes[node].children[0] = left;
+            nodes[node].children[1] = right;
+        }
+
+        /**
+         * @brief Builds a balanced sub-tree at "node" for the points in "rebuildPoints" whose indices are in
+         * "rebuildOrder" from position "begin" to position "end"
+         */
+        void buildBalanced(size_t node, size_t begin, size_t end) {
+            const size_t nofPoints = end-begin;
+            int *lower = lowerBounds(node);
+            int *upper = upperBounds(node);
+            std::copy(rebuildPoints[rebuildOrder[begin]],rebuildPoints[rebuildOrder[begin]]+nofDimensions,lower);
+            std::copy(rebuildPoints[rebuildOrder[begin]],rebuildPoints[rebuildOrder[begin]]+nofDimensions,upper);
+            for (size_t i=begin+1;i<end;i++) {
+                const int *point = rebuildPoints[rebuildOrder[i]];
+                for (size_t d=0;d<nofDimensions;d++) {
+                    lower[d] = std::min(lower[d],point[d]);
+                    upper[d] = std::max(upper[d],point[d]);
+                }
+            }
+            nodes[node].nofPoints = nofPoints;
+
+            if (nofPoints<=blockCapacity) {
+                nodes[node].isLeaf = true;
+                nodes[node].block = newBlock();
+                for (size_t i=0;i<nofPoints;i++) {
+                    for (size_t d=0;d<nofDimensions;d++) setValue(nodes[node].block,d,i,rebuildPoints[rebuildOrder[begin+i]][d]);
+                }
+                return;
+            }
+
+            // Split at the median of the dimension with the largest spread, as in "splitLeaf". There are more points
+            // than fit into a leaf, so they cannot all be the same.
+            size_t splitDimension = 0;
+            for (size_t d=1;d<nofDimensions;d++) {
+                if (((long long)upper[d]-lower[d])>((long long)upper[splitDimension]-lower[splitDimension])) splitDimension = d;
+            }
+            const int maxValue = upper[splitDimension];
+            const PointSet &points = rebuildPoints;
+            std::vector<size_t>::iterator first = rebuildOrder.begin()+begin;
+            std::vector<size_t>::iterator last = rebuildOrder.begin()+end;
+            std::nth_element(first,first+nofPoints/2,last,[&points,splitDimension](size_t a, size_t b) {
+                return points[a][splitDimension]<points[b][splitDimension];
+            });
+            int splitValue = points[*(first+nofPoints/2)][splitDimension];
+            if (splitValue==maxValue) {
+                splitValue = lower[splitDimension];
+                for (size_t i=begin;i<end;i++) {
+                    const int v = points[rebuildOrder[i]][splitDimension];
+                    if ((v<maxValue) && (v>splitValue)) splitValue = v;
+                }
+            }
+            const size_t middle = std::partition(first,last,[&points,splitDimension,splitValue](size_t a) {
+                return points[a][splitDimension]<=splitValue;
+            })-rebuildOrder.begin();
+
+            nodes[node].isLeaf = false;
+            nodes[node].nofPointsWhenBuilt = nofPoints;
+            nodes[node].splitDimension = splitDimension;
+            nodes[node].splitValue = splitValue;
+            size_t left = newNode();
+            size_t right = newNode();
+            nodes[node].children[0] = left;
+            nodes[node].children[1] = right;
+            buildBalanced(left,begin,middle);
+            buildBalanced(right,middle,end);
+        }
+
+        /**
+         * @brief Rebuilds the highest sub-tree on the path to "point" that is out of balance, if there is one
+         */
+        void rebalance(const int *point) {
+            size_t node = 0;
+            while (!nodes[node].isLeaf) {
+                const size_t larger = std::max(nodes[nodes[node].children[0]].nofPoints,nodes[nodes[node].children[1]].nofPoints);
+                if ((4*larger>3*nodes[node].nofPoints) && (nodes[node].nofPoints>=2*nodes[node].nofPointsWhenBuilt)) {
+                    rebuildPoints.clear();
+                    collectSubtree(node,rebuildPoints);
+                    freeSubtree(nodes[node].children[0]);
+                    freeSubtree(nodes[node].children[1]);
+                    rebuildOrder.resize(rebuildPoints.size());
+                    for (size_t i=0;i<rebuildOrder.size();i++) rebuildOrder[i] = i;
+                    buildBalanced(node,0,rebuildOrder.size());
+                    return;
+                }
+                node = nodes[node].children[(point[nodes[node].splitDimension]<=nodes[node].splitValue)?0:1];
+            }
+        }
+
+        PointIndex(size_t _nofDimensions, unsigned int _bitsPerCoordinate, const std::vector<std::pair<int,int> > *limits) : nofDimensions(_nofDimensions),
+            bitsPerCoordinate(_bitsPerCoordinate), wordsPerPackedColumn(_bitsPerCoordinate), offsets(PointStorage<N>::make(_nofDimensions)),
+            packedPoint(PointStorage<N>::make(_nofDimensions)), nofBlocks(0), pointBuffer(_nofDimensions), rebuildPoints(_nofDimensions), kernels(getBlockKernels<N>()),
+            packedKernels((_bitsPerCoordinate<32)?getPackedBlockKernels<N>(_bitsPerCoordinate):PackedBlockKernels()) {
+            for (size_t d=0;d<nofDimensions;d++) offsets[d] = (limits!=NULL)?(*limits)[d].first:0;
+            newNode();
+            nodes[0].block = newBlock();
+        }
+
+    public:
+        /**
+         * @brief Creates an index for arbitrary points, which stores them unpacked
+         */
+        PointIndex(size_t _nofDimensions) : PointIndex(_nofDimensions,32,NULL) {}
+
+        /**
+         * @brief Creates an index for points within the given limits. With "packCoordinates", the coordinates are stored
+         * packed if the ranges of the limits permit it. Adding a point outside of the limits then throws an exception.
+         */
+        PointIndex(const std::vector<std::pair<int,int> > &limits, bool packCoordinates) :
+            PointIndex(limits.size(),packCoordinates?bitsPerCoordinateFor(limits):32,&limits) {}
+
+        size_t size() const { return nodes[0].nofPoints; }
+        bool empty() const { return nodes[0].nofPoints==0; }
+
+        /**
+         * @brief The number of bits with which the coordinates are stored, which is 32 if they are not packed
+         */
+        unsigned int bitsPerStoredCoordinate() const { return bitsPerCoordinate; }
+
+        /**
+         * @brief The number of bytes taken by the nodes and blocks in use. Freed ones are reused before new ones are
+         * allocated, so the memory allocated for the index does not grow beyond the largest value of this number.
+         */
+        size_t memoryUsage() const {
+            const size_t bytesPerBlock = (bitsPerCoordinate==32)?blockCapacity*nofDimensions*sizeof(int):wordsPerPackedColumn*nofDimensions*sizeof(uint64_t);
+            return (nodes.size()-freeNodes.size())*(sizeof(Node)+2*nofDimensions*sizeof(int))+(nofBlocks-freeBlocks.size())*bytesPerBlock;
+        }
+
+        /**
+         * @brief Checks if some stored point is pointwise greater than or equal to the given point
+         */
+        bool containsGeq(const int *point) {
+            size_t nofVisitedNodes = 0;
+            const int *query = packQuery<true>(point);
+            return (query!=NULL) && containsRecurse<true,false>(0,query,nofVisitedNodes);
+        }
+
+        /**
+         * @brief Variant of "containsGeq" that adds the number of nodes that the query visits to "nofVisitedNodes"
+         */
+        bool containsGeq(const int *point, size_t &nofVisitedNodes) {
+            const int *query = packQuery<true>(point);
+            return (query!=NULL) && containsRecurse<true,true>(0,query,nofVisitedNodes);
+        }
+
+        /**
+         * @brief Removes all stored points that are pointwise smaller than or equal to the given point
+         */
+        void removeLeq(const int *point) {
+            const int *query = packQuery<false>(point);
+            if (query!=NULL) removeRecurse<false>(0,query,NULL);
+        }
+
+        /**
+         * @brief Checks if some stored point is pointwise smaller than or equal to the given point
+         */
+        bool containsLeq(const int *point) {
+            size_t nofVisitedNodes = 0;
+            const int *query = packQuery<false>(point);
+            return (query!=NULL) && containsRecurse<false,false>(0,query,nofVisitedNodes);
+        }
+
+        /**
+         * @brief Removes all stored points that are pointwise greater than or equal to the given point
+         */
+        void removeGeq(const int *point) {
+            const int *query = packQuery<true>(point);
+            if (query!=NULL) removeRecurse<true>(0,query,NULL);
+        }
+
+        /**
+         * @brief Appends all stored points to "out"
+         */
+        void getPoints(PointSet &out) {
+            const size_t first = out.size();
+            collectSubtree(0,out);
+            unpackPoints(out,first);
+        }
+
+        /**
+         * @brief Removes all stored points and appends them to "out"
+         */
+        void extractAll(PointSet &out) {
+            const size_t first = out.size();
+            collectSubtree(0,out);
+            unpackPoints(out,first);
+            makeEmptyLeaf(0);
+        }
+
+        /**
+         * @brief Appends all stored points that are pointwise greater than or equal to the given point to "out"
+         */
+        void getGeq(const int *point, PointSet &out) {
+            const size_t first = out.size();
+            const int *query = packQuery<true>(point);
+            if (query!=NULL) collectRecurse<true>(0,query,out);
+            unpackPoints(out,first);
+        }
+
+        /**
+         * @brief Removes all stored points that are pointwise greater than or equal to the given point and appends
+         * them to "out".
+         */
+        void extractGeq(const int *point, PointSet &out) {
+            const size_t first = out.size();
+            const int *query = packQuery<true>(point);
+            if (query!=NULL) removeRecurse<true>(0,query,&out);
+            unpackPoints(out,first);
+        }
+
+        /**
+         * @brief Removes one stored point that is equal to the given point
+         * @return whether there was such a point
+         */
+        bool remove(const int *point) {
+            const int *query = packWithinLimits(point);
+            return (query!=NULL) && removeOneRecurse(0,query);
+        }
+
+        /**
+         * @brief Removes some point from the index and copies it to "out". The index must not be empty.
+         */
+        void pop(int *out) {
+            popRecurse(0,out);
+            unpack(out);
+        }
+
+        void insert(const int *point) {
+            point = pack(point);
+            size_t node = 0;
+            while (true) {
+                int *lower = lowerBounds(node);
+                int *upper = upperBounds(node);
+                if (nodes[node].nofPoints==0) {
+                    std::copy(point,point+nofDimensions,lower);
+                    std::copy(point,point+nofDimensions,upper);
+                } else {
+                    for (size_t d=0;d<nofDimensions;d++) {
+                        lower[d] = std::min(lower[d],point[d]);
+                        upper[d] = std::max(upper[d],point[d]);
+                    }
+                }
+                if (nodes[node].isLeaf && (nodes[node].nofPoints==blockCapacity)) {
+                    splitLeaf(node);
+                }
+                nodes[node].nofPoints++;
+                if (nodes[node].isLeaf) {
+                    if (nodes[node].nofPoints>blockCapacity) throw "PointIndex: too many equal points in a leaf.";
+                    for (size_t d=0;d<nofDimensions;d++) setValue(nodes[node].block,d,nodes[node].nofPoints-1,point[d]);
+                    rebalance(point);
+                    return;
+                }
+                node = nodes[node].children[(point[nodes[node].splitDimension]<=nodes[node].splitValue)?0:1];
+            }
+        }
+    };
+
+
+    /**
+     * @brief A class that buffers negative results from the feasibility function so that no
+     * redundant calls are made to it.
+     *
+     * Dominated points are removed from the buffer. The points are kept in a PointIndex so that
+     * a query does not need to look at all buffered points.
+     */
+    template<size_t N> class NegativeResultBuffer {
+        PointIndex<N> oldValueBuffer;
+    public:
+        NegativeResultBuffer(const std::vector<std::pair<int,int> > &limits, bool packCoordinates) : oldValueBuffer(limits,packCoordinates) {}
+
+        bool isContained(const int *data) {
+            return oldValueBuffer.containsGeq(data);
+        }
+
+        bool isContained(const int *data, size_t &nofVisitedNodes) {
+            return oldValueBuffer.containsGeq(data,nofVisitedNodes);
+        }
+
+        size_t size() const { return oldValueBuffer.size(); }
+        size_t memoryUsage() const { return oldValueBuffer.memoryUsage(); }
+
+        void getPoints(PointSet &out) { oldValueBuffer.getPoints(out); }
+        void extractAll(PointSet &out) { oldValueBuffer.extractAll(out); }
+
+        /**
+         * @brief Adds points of which none is smaller than or equal to another one or to a point in the buffer
+         */
+        void addMaximalPoints(const PointSet &points) {
+            for (size_t i=0;i<points.size();i++) oldValueBuffer.insert(points[i]);
+        }
+
+        void addPoint(const int *data) {
+            oldValueBuffer.removeLeq(data);
+            oldValueBuffer.insert(data);
+        }
+    };
+
+
+    /**
+     * @brief The counterpart to the NegativeResultBuffer: a class that buffers positive results from the feasibility
+     * function. Every point that is pointwise greater than or equal to a buffered point is feasible as well.
+     *
+     * Dominating points are removed from the buffer.
+     */
+    template<size_t N> class PositiveResultBuffer {
+        PointIndex<N> oldValueBuffer;
+    public:
+        PositiveResultBuffer(const std::vector<std::pair<int,int> > &limits, bool packCoordinates) : oldValueBuffer(limits,packCoordinates) {}
+
+        bool isContained(const int *data) {
+            return oldValueBuffer.containsLeq(data);
+        }
+
+        size_t memoryUsage() const { return oldValueBuffer.memoryUsage(); }
+
+        void getPoints(PointSet &out) { oldValueBuffer.getPoints(out); }
+
+        void addPoint(const int *data) {
+            oldValueBuffer.removeGeq(data);
+            oldValueBuffer.insert(data);
+        }
+
+        void removeGeq(const int *data) {
+            oldValueBuffer.removeGeq(data);
+        }
+    };
+
+
+    /**
+     * @brief The co-Pareto elements (the set "S" from the paper) together with the order in which they are taken for testing
+     * them (see "CoParetoSelection").
+     *
+     * Except for SELECT_IN_INDEX_ORDER, the elements are additionally kept in priority queues, one per dimension for
+     * SELECT_ROUND_ROBIN and a single one otherwise. Elements that "extractGeq" removes from the index stay in the queues,
+     * so an element that is taken from a queue is only used if it can still be removed from the index. The queues are
+     * rebuilt when most of their entries are outdated.
+     *
+     * For SELECT_LARGEST_GAP_FIRST, the priorities are the volumes that "undecidedVolumeBelow" computes. They can only
+     * shrink while the run goes on, so the priority of an element is recomputed when it is taken from the queue, and the
+     * element is put back if it is then smaller than the priority of the next element.
+     */
+    template<size_t N> class CoParetoSet {
+        struct QueueEntry {
+            double priority;
+            size_t point; // In "queuedPoints"
+            bool operator<(const QueueEntry &other) const { return priority<other.priority; }
+        };
+
+        PointIndex<N> elements;
+        const std::vector<std::pair<int,int> > &limits;
+        const CoParetoSelection selection;
+        const std::function<double(const std::vector<int> &)> selectionPriority;
+        const std::function<double(const int *)> undecidedVolumeBelow;
+        std::vector<std::priority_queue<QueueEntry> > queues;
+        PointSet queuedPoints;
+        size_t nextQueue;
+        std::vector<int> priorityPoint;
+
+        double priority(const int *point, size_t queue) {
+            switch (selection) {
+            case SELECT_LARGEST_GAP_FIRST:
+                if (undecidedVolumeBelow) return undecidedVolumeBelow(point);
+                // Fall through
+            case SELECT_LARGEST_BOX_FIRST: {
+                double logVolume = 0.0;
+                for (size_t d=0;d<limits.size();d++) logVolume += std::log((double)point[d]-limits[d].first+1.0);
+                return logVolume;
+            }
+            case SELECT_ROUND_ROBIN:
+                return point[queue];
+            default:
+                priorityPoint.assign(point,point+limits.size());
+                return selectionPriority(static_cast<const std::vector<int> &>(priorityPoint));
+            }
+        }
+
+        void enqueue(const int *point) {
+            queuedPoints.push_back(point);
+            for (size_t i=0;i<queues.size();i++) {
+                QueueEntry entry;
+                entry.priority = priority(point,i);
+                entry.point = queuedPoints.size()-1;
+                queues[i].push(entry);
+            }
+        }
+
+        void rebuildQueuesIfOutdated() {
+            if (queuedPoints.size()<=2*elements.size()+blockCapacity) return;
+            for (auto &queue : queues) queue = std::priority_queue<QueueEntry>();
+            PointSet points(limits.size());
+            elements.getPoints(points);
+            queuedPoints.clear();
+            for (size_t i=0;i<points.size();i++) enqueue(points[i]);
+        }
+
+    public:
+        CoParetoSet(const std::vector<std::pair<int,int> > &_limits, const EnumerationOptions &options,
+            const std::function<double(const int *)> &_undecidedVolumeBelow = std::function<double(const int *)>()) : elements(_limits,options.packCoordinates),
+            limits(_limits), selection(options.selection), selectionPriority(options.selectionPriority), undecidedVolumeBelow(_undecidedVolumeBelow),
+            queues((options.selection==SELECT_IN_INDEX_ORDER)?0:((options.selection==SELECT_ROUND_ROBIN)?_limits.size():1)),
+            queuedPoints(_limits.size()), nextQueue(0) {
+            if ((selection==SELECT_BY_PRIORITY) && !selectionPriority) throw "Error: SELECT_BY_PRIORITY needs a selection priority function.";
+        }
+
+        size_t size() const { return elements.size(); }
+        bool empty() const { return elements.empty(); }
+        bool containsGeq(const int *point) { return elements.containsGeq(point); }
+        bool containsLeq(const int *point) { return elements.containsLeq(point); }
+        void getPoints(PointSet &out) { elements.getPoints(out); }
+        void getGeq(const int *point, PointSet &out) { elements.getGeq(point,out); }
+
+        size_t memoryUsage() const {
+            size_t nofQueueEntries = 0;
+            for (auto const &queue : queues) nofQueueEntries += queue.size();
+            return elements.memoryUsage()+queuedPoints.coordinates().size()*sizeof(int)+nofQueueEntries*sizeof(QueueEntry);
+        }
+
+        void insert(const int *point) {
+            elements.insert(point);
+            if (!queues.empty()) {
+                enqueue(point);
+                rebuildQueuesIfOutdated();
+            }
+        }
+
+        void removeLeq(const int *point) {
+            elements.removeLeq(point);
+            if (!queues.empty()) rebuildQueuesIfOutdated();
+        }
+
+        void extractGeq(const int *point, PointSet &out) {
+            elements.extractGeq(point,out);
+            if (!queues.empty()) rebuildQueuesIfOutdated();
+        }
+
+        /**
+         * @brief Keeps the "nofKept" elements that "pop" would return next and moves all others to "out"
+         */
+        void removeAllBut(size_t nofKept, PointSet &out) {
+            PointSet kept(limits.size());
+            std::vector<int> point(limits.size());
+            while ((kept.size()<nofKept) && !elements.empty()) {
+                pop(point.data());
+                kept.push_back(point);
+            }
+            elements.extractAll(out);
+            for (auto &queue : queues) queue = std::priority_queue<QueueEntry>();
+            queuedPoints.clear();
+            for (size_t i=0;i<kept.size();i++) insert(kept[i]);
+        }
+
+        /**
+         * @brief Removes the next element to be tested and copies it to "out". The set must not be empty.
+         */
+        void pop(int *out) {
+            if (queues.empty()) {
+                elements.pop(out);
+                return;
+            }
+            std::priority_queue<QueueEntry> &queue = queues[nextQueue];
+            nextQueue = (nextQueue+1) % queues.size();
+            while (true) {
+                QueueEntry entry = queue.top();
+                const int *point = queuedPoints[entry.point];
+                queue.pop();
+                if (!elements.remove(point)) continue;
+                if ((selection==SELECT_LARGEST_GAP_FIRST) && undecidedVolumeBelow && !queue.empty()) {
+                    entry.priority = undecidedVolumeBelow(point);
+                    if (entry.priority<queue.top().priority) {
+                        elements.insert(point);
+                        queue.push(entry);
+                        continue;
+                    }
+                }
+                std::copy(point,point+limits.size(),out);
+                return;
+            }
+        }
+    };
+
+
+    /**
+     * @brief Updates the co-Pareto elements (the set "S" from the paper) after a new Pareto point has been found.
+     *
+     * Only the elements that are pointwise greater than or equal to the new point change, and each of them is split into one
+     * child per dimension. A child obtained by lowering dimension i can only be redundant because of another child for
+     * dimension i or because of an untouched element that has the value x[i]-1 in dimension i. Hence, the children only
+     * need to be checked against each other and against the untouched elements that dominate them, which the index
+     * finds without looking at the whole set (see Klamroth, Lacour and Vanderpooten: "On the representation of the
+     * search region in multi-objective optimization", EJOR 245(3), 2015).
+     *
+     * @param coParetoElements the co-Pareto elements
+     * @param x the new Pareto point
+     * @param limits the upper and lower bounds of the objective values
+     * @param dominatedElements co-Pareto elements that are greater than or equal to "x" but have already been taken out of
+     *        "coParetoElements". The other co-Pareto elements that are greater than or equal to "x" are added to this set.
+     * @param children scratch space for the new co-Pareto elements
+     */
+    template<size_t N> void updateCoParetoElements(CoParetoSet<N> &coParetoElements, const int *x, const std::vector<std::pair<int,int> > &limits, PointSet &dominatedElements, PointSet &children) {
+        const Dimensions<N> nofDimensions(limits.size());
+        coParetoElements.extractGeq(x,dominatedElements);
+        for (size_t i=0;i<nofDimensions;i++) {
+            if (x[i]>limits[i].first) {
+                children.clear();
+                for (size_t j=0;j<dominatedElements.size();j++) {
+                    children.push_back(dominatedElements[j]);
+                    children.back()[i] = x[i]-1;
+                }
+
+                // Children for different dimensions never dominate each other, so the ones for the earlier dimensions
+                // that are already in the index do not influence the check. Children that are kept are added at once,
+                // so that of several equal children, only the first one is kept.
+                for (size_t j=0;j<children.size();j++) {
+                    bool redundant = coParetoElements.containsGeq(children[j]);
+                    for (size_t k=0;(k<children.size()) && !redundant;k++) {
+                        redundant = pointIsSmaller(children[j],children[k],nofDimensions);
+                    }
+                    if (!redundant) coParetoElements.insert(children[j]);
+                }
+            }
+        }
+    }
+
+
+    /**
+     * @brief The volume of the union of boxes that have one corner at the origin, where "extents" holds the side lengths
+     * of the boxes, "nofDimensions" values per box
+     */
+    double volumeOfUnion(const std::vector<double> &extents, size_t nofDimensions);
+
+    /**
+     * @brief Keeps the bounds on the hypervolume of the Pareto front (see "HypervolumeBound") up to date while Pareto points
+     * and infeasible points come in.
+     *
+     * The points that the Pareto points found so far do not dominate are the union of the boxes between the lower limits
+     * and the co-Pareto elements for these Pareto points. The elements are kept in a set of their own, as the enumeration
+     * drops the co-Pareto elements that are found to be infeasible. A new Pareto point x dominates exactly those points
+     * that are between x and one of the elements that are greater than or equal to x, and "updateCoParetoElements"
+     * removes these elements anyway, so only a few boxes need to be measured for a Pareto point. The points that are not
+     * known to be infeasible are kept track of in the same way with all orders reversed, by mirroring all points at the
+     * center of the limits.
+     */
+    template<size_t N> class HypervolumeTracker {
+        const std::vector<std::pair<int,int> > &limits;
+        const Dimensions<N> nofDimensions;
+        CoParetoSet<N> nonDominatedCorners;
+        CoParetoSet<N> mirroredFeasibleCorners;
+        HypervolumeBound bound;
+
+        // Scratch space
+        PointSet corners;
+        PointSet children;
+        typename PointStorage<N>::Point mirroredPoint;
+        std::vector<double> extents;
+
+        const int *mirror(const int *point) {
+            for (size_t i=0;i<nofDimensions;i++) mirroredPoint[i] = (int)((long long)limits[i].first+limits[i].second-point[i]);
+            return mirroredPoint.data();
+        }
+
+        /**
+         * @brief The volume of the union of the boxes between "point" and the points in "corners"
+         */
+        double volumeOfCornerBoxes(const int *point) {
+            extents.clear();
+            for (size_t j=0;j<corners.size();j++) {
+                for (size_t i=0;i<nofDimensions;i++) extents.push_back((double)corners[j][i]-point[i]+1.0);
+            }
+            return volumeOfUnion(extents,nofDimensions);
+        }
+
+    public:
+        HypervolumeTracker(const std::vector<std::pair<int,int> > &_limits) : limits(_limits), nofDimensions(_limits.size()),
+            nonDominatedCorners(_limits,EnumerationOptions()), mirroredFeasibleCorners(_limits,EnumerationOptions()),
+            corners(nofDimensions), children(nofDimensions), mirroredPoint(PointStorage<N>::make(nofDimensions)) {
+            bound.totalVolume = 1.0;
+            for (auto const &limit : limits) bound.totalVolume *= (double)limit.second-limit.first+1.0;
+            bound.dominatedVolume = 0.0;
+            bound.undecidedVolume = bound.totalVolume;
+            // The maximal point is also the mirror image of the minimal point
+            for (size_t i=0;i<nofDimensions;i++) mirroredPoint[i] = limits[i].second;
+            nonDominatedCorners.insert(mirroredPoint.data());
+            mirroredFeasibleCorners.insert(mirroredPoint.data());
+        }
+
+        void addParetoPoint(const int *point) {
+            corners.clear();
+            updateCoParetoElements(nonDominatedCorners,point,limits,corners,children);
+            const double volume = volumeOfCornerBoxes(point);
+            bound.dominatedVolume += volume;
+            bound.undecidedVolume -= volume;
+        }
+
+        void addInfeasiblePoint(const int *point) {
+            corners.clear();
+            const int *mirrored = mirror(point);
+            updateCoParetoElements(mirroredFeasibleCorners,mirrored,limits,corners,children);
+            bound.undecidedVolume -= volumeOfCornerBoxes(mirrored);
+        }
+
+        /**
+         * @brief The volume of the points that are smaller than or equal to "point" and not known to be infeasible. For a
+         * co-Pareto element, these points are all undecided.
+         */
+        double undecidedVolumeBelow(const int *point) {
+            corners.clear();
+            const int *mirrored = mirror(point);
+            mirroredFeasibleCorners.getGeq(mirrored,corners);
+            return volumeOfCornerBoxes(mirrored);
+        }
+
+        HypervolumeBound getBound() const {
+            // Rounding errors must not make the undecided volume negative
+            HypervolumeBound result = bound;
+            result.undecidedVolume = std::max(result.undecidedVolume,0.0);
+            return result;
+        }
+    };
+
+
+    /**
+     * @brief Collects the statistics of a run in an EnumerationStats object. The enumerator calls the feasibility
+     * function, looks up points in the negative result buffer and updates the co-Pareto elements through it.
+     */
+    class StatsRecorder {
+        EnumerationStats &stats;
+        std::chrono::steady_clock::time_point runStart;
+        std::chrono::steady_clock::time_point coParetoUpdateStart;
+
+        static double secondsSince(std::chrono::steady_clock::time_point start) {
+            return std::chrono::duration<double>(std::chrono::steady_clock::now()-start).count();
+        }
+
+    public:
+        StatsRecorder(EnumerationStats *_stats) : stats(*_stats) {}
+
+        void startRun() {
+            stats = EnumerationStats();
+            runStart = std::chrono::steady_clock::now();
+        }
+
+        void finishRun(const std::vector<size_t> &nofSearchCallsPerDimension) {
+            stats.nofSearchOracleCallsPerDimension = nofSearchCallsPerDimension;
+            stats.bookkeepingTime = secondsSince(runStart)-stats.oracleTime;
+        }
+
+        template<class Oracle> void evaluate(Oracle &oracle, const PointBatch &points, std::vector<bool> &results, bool isSearch) {
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            oracle.evaluate(points,results);
+            stats.oracleTime += secondsSince(start);
+            stats.nofOracleCalls += points.size();
+            (isSearch?stats.nofSearchOracleCalls:stats.nofCoParetoOracleCalls) += points.size();
+            for (size_t i=0;i<points.size();i++) (results[i]?stats.nofFeasibleOracleCalls:stats.nofInfeasibleOracleCalls)++;
+        }
+
+        template<size_t N> bool isCoveredNegatively(NegativeResultBuffer<N> &buffer, const int *point) {
+            stats.nofNegativeBufferLookups++;
+            bool result = buffer.isContained(point,stats.nofNegativeBufferNodesVisited);
+            if (result) stats.nofNegativeBufferHits++;
+            return result;
+        }
+
+        template<size_t N> void updateCoParetoElements(CoParetoSet<N> &coParetoElements, const int *x, const std::vector<std::pair<int,int> > &limits, PointSet &dominatedElements, PointSet &children) {
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            detail::updateCoParetoElements(coParetoElements,x,limits,dominatedElements,children);
+            stats.coParetoUpdateTime += secondsSince(start);
+        }
+
+        void recordParetoPoint() {
+            stats.nofParetoPointsFound++;
+        }
+
+        void recordCacheHits(size_t nofHits) {
+            stats.nofOracleCacheHits += nofHits;
+        }
+
+        void recordSizes(size_t nofCoParetoElements, size_t nofNegativePoints, size_t memoryUsage) {
+            stats.maxNofCoParetoElements = std::max(stats.maxNofCoParetoElements,nofCoParetoElements);
+            stats.maxNofNegativePoints = std::max(stats.maxNofNegativePoints,nofNegativePoints);
+            stats.maxMemoryUsage = std::max(stats.maxMemoryUsage,memoryUsage);
+        }
+
+        void recordSpill(size_t nofCoParetoElements, size_t nofNegativePoints) {
+            stats.nofSpilledCoParetoElements += nofCoParetoElements;
+            stats.nofSpilledNegativePoints += nofNegativePoints;
+        }
+    };
+
+    /**
+     * @brief The counterpart to StatsRecorder for runs without statistics. It only forwards the calls.
+     */
+    class NoStatsRecorder {
+    public:
+        NoStatsRecorder(EnumerationStats *) {}
+        void startRun() {}
+        void finishRun(const std::vector<size_t> &) {}
+
+        template<class Oracle> void evaluate(Oracle &oracle, const PointBatch &points, std::vector<bool> &results, bool) {
+            oracle.evaluate(points,results);
+        }
+
+        template<size_t N> bool isCoveredNegatively(NegativeResultBuffer<N> &buffer, const int *point) {
+            return buffer.isContained(point);
+        }
+
+        template<size_t N> void updateCoParetoElements(CoParetoSet<N> &coParetoElements, const int *x, const std::vector<std::pair<int,int> > &limits, PointSet &dominatedElements, PointSet &children) {
+            detail::updateCoParetoElements(coParetoElements,x,limits,dominatedElements,children);
+        }
+
+        void recordParetoPoint() {}
+        void recordCacheHits(size_t) {}
+        void recordSizes(size_t, size_t, size_t) {}
+        void recordSpill(size_t, size_t) {}
+    };
+
+
+    //=============================================================================================================
+    // Oracles: the interface between the enumeration algorithm and the different kinds of feasibility functions. Every
+    // oracle has the functions
+    //      size_t maxBatchSize() const;
+    //          The number of independent points that the enumeration algorithm should collect for a call to "evaluate"
+    //      void evaluate(const PointBatch &points, std::vector<bool> &results);
+    //          Computes the value of the feasibility function for all points in "points"
+    // The feasibility functions are template parameters, so that calls to them can be inlined.
+    //=============================================================================================================
+    template<class F> class SinglePointOracle {
+        F &fn;
+        std::vector<int> point;
+    public:
+        SinglePointOracle(F &_fn, size_t nofDimensions) : fn(_fn), point(nofDimensions) {}
+        size_t maxBatchSize() const { return 1; }
+        void evaluate(const PointBatch &points, std::vector<bool> &results) {
+            results.resize(points.size());
+            for (size_t i=0;i<points.size();i++) {
+                std::copy(points[i],points[i]+point.size(),point.begin());
+                results[i] = fn(static_cast<const std::vector<int> &>(point));
+            }
+        }
+    };
+
+    template<class F> class BatchOracle {
+        F &fn;
+        const size_t batchSize;
+    public:
+        BatchOracle(F &_fn, size_t _batchSize) : fn(_fn), batchSize(std::max(_batchSize,size_t(1))) {}
+        size_t maxBatchSize() const { return batchSize; }
+        void evaluate(const PointBatch &points, std::vector<bool> &results) {
+            results = fn(points);
+            if (results.size()!=points.size()) throw "Error: The batch feasibility function returned a wrong number of results.";
+        }
+    };
+
+
+
+    /**
+     * @brief A fixed set of worker threads that run a function for all indices in a range. The thread that calls "run"
+     * works on the range as well, so a pool for n threads starts n-1 workers.
+     */
+    class ThreadPool {
+        std::vector<std::thread> workers;
+        std::mutex mutex;
+        std::condition_variable workAvailable;
+        std::condition_variable workDone;
+        const std::function<void(size_t,size_t)> *job;
+        size_t jobSize;
+        size_t nextIndex;
+        size_t nofUnfinishedIndices;
+        size_t round;
+        bool terminate;
+        std::exception_ptr firstException;
+
+        /**
+         * @brief Works on the current job until all of its indices have been taken. The mutex must be held when calling this
+         * function, and it is held again when the function returns.
+         */
+        void work(std::unique_lock<std::mutex> &lock, size_t threadNumber) {
+            while (nextIndex<jobSize) {
+                size_t index = nextIndex++;
+                lock.unlock();
+                try {
+                    (*job)(threadNumber,index);
+                } catch (...) {
+                    lock.lock();
+                    if (!firstException) firstException = std::current_exception();
+                    lock.unlock();
+                }
+                lock.lock();
+                if (--nofUnfinishedIndices==0) workDone.notify_all();
+            }
+        }
+
+        void workerLoop(size_t threadNumber) {
+            std::unique_lock<std::mutex> lock(mutex);
+            size_t lastRound = 0;
+            while (true) {
+                workAvailable.wait(lock,[this,lastRound]() { return terminate || (round!=lastRound); });
+                if (terminate) return;
+                lastRound = round;
+                work(lock,threadNumber);
+            }
+        }
+
+    public:
+        ThreadPool(unsigned int nofThreads) : job(NULL), jobSize(0), nextIndex(0), nofUnfinishedIndices(0), round(0), terminate(false) {
+            for (unsigned int i=1;i<nofThreads;i++) {
+                workers.push_back(std::thread(&ThreadPool::workerLoop,this,i));
+            }
+        }
+
+        ~ThreadPool() {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                terminate = true;
+            }
+            workAvailable.notify_all();
+            for (auto &thread : workers) thread.join();
+        }
+
+        size_t nofThreads() const { return workers.size()+1; }
+
+        /**
+         * @brief Calls "fn(threadNumber,index)" for all indices from 0 to nofIndices-1, where "threadNumber" is smaller
+         * than "nofThreads()" and no two concurrent calls get the same thread number. If some call throws an exception, the
+         * first such exception is re-thrown after all calls have finished.
+         */
+        void run(size_t nofIndices, const std::function<void(size_t,size_t)> &fn) {
+            if (nofIndices==0) return;
+            std::unique_lock<std::mutex> lock(mutex);
+            job = &fn;
+            jobSize = nofIndices;
+            nextIndex = 0;
+            nofUnfinishedIndices = nofIndices;
+            firstException = std::exception_ptr();
+            round++;
+            workAvailable.notify_all();
+            work(lock,0);
+            workDone.wait(lock,[this]() { return nofUnfinishedIndices==0; });
+            job = NULL;
+            if (firstException) std::rethrow_exception(firstException);
+        }
+    };
+
+    /**
+     * @brief Evaluates the points of a batch on several threads. The feasibility function must then be thread-safe.
+     */
+    template<class F> class ParallelOracle {
+        F &fn;
+        ThreadPool threadPool;
+        std::vector<std::vector<int> > points; // One per thread
+        std::vector<char> threadResults; // std::vector<bool> cannot be written concurrently
+    public:
+        ParallelOracle(F &_fn, size_t nofDimensions, unsigned int nofThreads) : fn(_fn), threadPool(nofThreads), points(nofThreads,std::vector<int>(nofDimensions)) {}
+        size_t maxBatchSize() const { return threadPool.nofThreads(); }
+        void evaluate(const PointBatch &batch, std::vector<bool> &results) {
+            threadResults.resize(batch.size());
+            threadPool.run(batch.size(),[this,&batch](size_t threadNumber, size_t index) {
+                std::vector<int> &point = points[threadNumber];
+                std::copy(batch[index],batch[index]+point.size(),point.begin());
+                threadResults[index] = fn(static_cast<const std::vector<int> &>(point));
+            });
+            results.assign(threadResults.begin(),threadResults.end());
+        }
+    };
+
+    /**
+     * @brief Starts the evaluation of all points of a batch before waiting for the first result, so that an asynchronous
+     * feasibility function has as many calls pending as the batch has points. Every call gets its own copy of the point,
+     * which stays valid until the call has finished.
+     */
+    template<class F> class AsyncOracle {
+        typedef decltype(std::declval<F &>()(std::declval<const std::vector<int> &>())) Future;
+        F &fn;
+        const size_t maxNofPendingCalls;
+        std::vector<std::vector<int> > points;
+        std::vector<Future> pendingResults;
+    public:
+        AsyncOracle(F &_fn, size_t nofDimensions, size_t _maxNofPendingCalls) : fn(_fn), maxNofPendingCalls(std::max(_maxNofPendingCalls,size_t(1))),
+            points(maxNofPendingCalls,std::vector<int>(nofDimensions)) {}
+        size_t maxBatchSize() const { return maxNofPendingCalls; }
+        void evaluate(const PointBatch &batch, std::vector<bool> &results) {
+            results.resize(batch.size());
+            pendingResults.clear();
+            std::exception_ptr firstException;
+            try {
+                for (size_t i=0;i<batch.size();i++) {
+                    std::copy(batch[i],batch[i]+points[i].size(),points[i].begin());
+                    pendingResults.push_back(fn(static_cast<const std::vector<int> &>(points[i])));
+                }
+            } catch (...) {
+                firstException = std::current_exception();
+            }
+            // The results are collected in the order of the batch. Even after an exception, all calls that were started
+            // are waited for, as they may still read their points.
+            for (size_t i=0;i<pendingResults.size();i++) {
+                try {
+                    results[i] = static_cast<bool>(pendingResults[i].get());
+                } catch (...) {
+                    if (!firstException) firstException = std::current_exception();
+                }
+            }
+            pendingResults.clear();
+            if (firstException) std::rethrow_exception(firstException);
+        }
+    };
+
+
+
+    //=============================================================================================================
+    // Spill files, which take co-Pareto elements and infeasible points when a run would exceed its memory limit
+    //=============================================================================================================
+    /**
+     * @brief A temporary file that stores chunks of points. The last chunk can be taken back, after which its space is
+     * reused, and every chunk can be read without being taken back. The file is deleted when the object is destroyed.
+     */
+    class SpillFile {
+        const size_t nofDimensions;
+        std::FILE *file;
+        std::vector<uint64_t> chunkStarts; // In bytes
+        std::vector<size_t> chunkSizes; // In points
+        uint64_t end;
+        size_t nofPointsInChunks;
+
+        void seek(uint64_t offset);
+    public:
+        SpillFile(size_t nofDimensions, const std::string &directory);
+        ~SpillFile();
+        SpillFile(const SpillFile &) = delete;
+        SpillFile &operator=(const SpillFile &) = delete;
+
+        size_t nofChunks() const { return chunkStarts.size(); }
+        size_t nofPoints() const { return nofPointsInChunks; }
+
+        // Stores "points" as a new chunk, which is the last one from then on
+        void append(const PointSet &points);
+
+        // Append the points of a chunk to "out"
+        void read(size_t chunk, PointSet &out);
+        void popLast(PointSet &out);
+    };
+
+
+    /**
+     * @brief One run of the pareto front element enumeration algorithm
+     *
+     * In every round, up to "oracle.maxBatchSize()" co-Pareto elements that are not covered by the result buffers
+     * are taken from the set "S" and evaluated together. The feasible ones are put back, and for each of them that is still a
+     * co-Pareto element after the Pareto points found for the earlier ones have been processed, a Pareto point below it is
+     * searched for. As the co-Pareto elements form an antichain, the points in a batch never imply results for each other.
+     * This is not the case for the speculative probes of the search for a Pareto point if the search arity is greater than 1.
+     */
+    template<size_t N, class Oracle, class Stats> class ParetoEnumerator {
+        const std::vector<std::pair<int,int> > &limits;
+        const Dimensions<N> nofDimensions;
+        Oracle &oracle;
+        Stats stats;
+
+        // Where the Pareto points go. Either of them can be NULL.
+        PointSet *paretoFront;
+        const std::function<void(const std::vector<int> &)> *paretoPointSink;
+
+        // The set "S" from the paper and the result buffers
+        CoParetoSet<N> coParetoElements;
+        NegativeResultBuffer<N> negativeResultBuffer;
+        PositiveResultBuffer<N> positiveResultBuffer;
+
+        // Scratch space
+        PointSet batch;
+        std::vector<bool> results;
+        PointSet feasibleElements;
+        PointSet probe;
+        std::vector<bool> probeResult;
+        std::vector<int> probeValues;
+        const size_t searchArity;
+        const ValueSearch valueSearch;
+        std::vector<long long> nofResultsNearerToLowerLimit; // Minus the number of those nearer to the upper end, per dimension
+        const DimensionOrder dimensionOrder;
+        std::vector<unsigned int> searchOrder;
+        std::vector<size_t> nofSearchCallsPerDimension;
+        size_t nofSearches;
+        PointSet dominatedElements;
+        PointSet children;
+        typename PointStorage<N>::Point x;
+        std::vector<int> sinkPoint;
+
+        // Continuing from earlier runs
+        bool resumed;
+        const std::string stateFile;
+        const double stateFileSaveInterval;
+        std::chrono::steady_clock::time_point lastStateFileSave;
+        const EnumerationState *initialState;
+        EnumerationState *finalState;
+        const WarmStart *warmStart;
+        bool verifyingSeeds;
+
+        // Stopping early
+        const std::atomic<bool> *stopToken;
+        const double timeBudget;
+        const size_t oracleCallBudget;
+        size_t nofOracleCalls;
+        std::chrono::steady_clock::time_point runStart;
+        bool stopped;
+
+        // Results of earlier calls to the feasibility function
+        OracleCache *oracleCache;
+        PointBatch uncachedPoints;
+        std::vector<size_t> uncachedIndices;
+        std::vector<bool> uncachedResults;
+
+        // Bounding the memory. The co-Pareto elements in a chunk of the spill file are updated for the Pareto points
+        // found after the chunk was written when it is taken back. These Pareto points are kept in "paretoPointLog" while
+        // there are chunks.
+        const size_t memoryLimit;
+        const std::string spillDirectory;
+        std::unique_ptr<SpillFile> coParetoSpillFile;
+        std::unique_ptr<SpillFile> negativeSpillFile;
+        PointSet paretoPointLog;
+        std::vector<size_t> paretoPointLogSizeAtChunk; // One entry per chunk of "coParetoSpillFile"
+        size_t nofNegativePointsAfterSpill;
+        PointSet spilledPoints;
+
+        // Approximating the Pareto front. A point that is found splits the co-Pareto elements as if it were smaller by
+        // the tolerances.
+        const std::vector<int> approximationTolerance;
+        std::vector<int> splitPoint;
+
+        // Bounds on the hypervolume of the Pareto front. The tracker only exists if the bounds are needed.
+        std::unique_ptr<HypervolumeTracker<N> > hypervolume;
+        const std::function<void(const HypervolumeBound &)> hypervolumeProgress;
+        const double hypervolumeTarget;
+
+        /**
+         * @brief Calls the feasibility function on those "points" whose results are not in the oracle cache. Only
+         * these calls count against the budget.
+         */
+        void evaluate(const PointBatch &points, std::vector<bool> &results, bool isSearch) {
+            if (oracleCache==NULL) {
+                stats.evaluate(oracle,points,results,isSearch);
+                nofOracleCalls += points.size();
+                return;
+            }
+            results.resize(points.size());
+            uncachedPoints.clear();
+            uncachedIndices.clear();
+            for (size_t i=0;i<points.size();i++) {
+                bool result;
+                if (oracleCache->lookup(points[i],result)) {
+                    results[i] = result;
+                } else {
+                    uncachedPoints.push_back(points[i]);
+                    uncachedIndices.push_back(i);
+                }
+            }
+            stats.recordCacheHits(points.size()-uncachedPoints.size());
+            if (uncachedPoints.empty()) return;
+            stats.evaluate(oracle,uncachedPoints,uncachedResults,isSearch);
+            nofOracleCalls += uncachedPoints.size();
+            for (size_t i=0;i<uncachedIndices.size();i++) {
+                results[uncachedIndices[i]] = uncachedResults[i];
+                oracleCache->insert(uncachedPoints[i],uncachedResults[i]);
+            }
+        }
+
+        /**
+         * @brief Checks if the run has to stop because of the stop token or one of the budgets. It is called before every
+         * call to the feasibility function, at a point at which all co-Pareto elements whose feasibility has not been
+         * used yet are in "coParetoElements".
+         */
+        bool mustStop() {
+            if (!stopped) {
+                stopped = ((stopToken!=NULL) && stopToken->load()) || (nofOracleCalls>=oracleCallBudget) ||
+                    ((timeBudget<std::numeric_limits<double>::infinity()) && (std::chrono::duration<double>(std::chrono::steady_clock::now()-runStart).count()>=timeBudget)) ||
+                    ((hypervolumeTarget<1.0) && (hypervolume->getBound().quality()>=hypervolumeTarget));
+            }
+            return stopped;
+        }
+
+        /**
+         * @brief Puts the dimensions into the order in which the search below "x" lowers them
+         */
+        void computeSearchOrder() {
+            for (unsigned int i=0;i<nofDimensions;i++) searchOrder[i] = i;
+            switch (dimensionOrder) {
+            case SEARCH_IN_INDEX_ORDER:
+                break;
+            case SEARCH_ROTATING:
+                if (nofDimensions>1) std::rotate(searchOrder.begin(),searchOrder.begin()+(nofSearches%nofDimensions),searchOrder.end());
+                break;
+            case SEARCH_LARGEST_RANGE_FIRST:
+                std::stable_sort(searchOrder.begin(),searchOrder.end(),[this](unsigned int a, unsigned int b) {
+                    return (long long)x[a]-limits[a].first > (long long)x[b]-limits[b].first;
+                });
+                break;
+            case SEARCH_ADAPTIVE:
+                // Every search lowers every dimension, so the totals compare like the averages.
+                std::stable_sort(searchOrder.begin(),searchOrder.end(),[this](unsigned int a, unsigned int b) {
+                    return nofSearchCallsPerDimension[a]<nofSearchCallsPerDimension[b];
+                });
+                break;
+            }
+        }
+
+        /**
+         * @brief The direction in which the search for the smallest feasible value in a dimension starts by galloping:
+         * -1 for downwards from the feasible value, 1 for upwards from the lower limit, and 0 for bisection
+         */
+        int gallopDirectionFor(unsigned int dimension) const {
+            // A seed of a warm start is likely to be a Pareto point, and galloping downwards confirms this with one call
+            // per dimension.
+            if (verifyingSeeds) return -1;
+            switch (valueSearch) {
+            case SEARCH_BY_BISECTION: return 0;
+            case SEARCH_BY_GALLOPING_DOWN: return -1;
+            case SEARCH_BY_GALLOPING_UP: return 1;
+            case SEARCH_BY_GALLOPING_FROM_LIKELIER_END: return (nofResultsNearerToLowerLimit[dimension]>0)?1:-1;
+            }
+            return 0;
+        }
+
+        /**
+         * @brief Finds a Pareto point below a point that is known to be feasible, stores it in "x", and
+         * adds it to the Pareto front.
+         *
+         * The dimensions are lowered one after the other, in the order given by "dimensionOrder". In every round of the
+         * search for the smallest feasible value in a dimension, "searchArity" values are evaluated at once. With bisection,
+         * they split the remaining range into equally large parts, so that the search takes about log_{searchArity+1} rounds.
+         * With galloping, they are the next distances from the end of the range that the search starts from, until the
+         * first result from the other side of the smallest feasible value. The search then bisects the remaining range.
+         * When approximating, it stops as soon as the range is not larger than the tolerance and takes its upper end.
+         *
+         * @return false if the run had to stop before the Pareto point was found. The results of the search until then are
+         *         in the result buffers.
+         */
+        bool findParetoPoint(const int *feasiblePoint) {
+            std::copy(feasiblePoint,feasiblePoint+nofDimensions,x.begin());
+            computeSearchOrder();
+            nofSearches++;
+            for (unsigned int i : searchOrder) {
+                const size_t nofCallsBefore = nofOracleCalls;
+                // The smallest feasible value is at least "min" and at most "max". The latter is known to be feasible.
+                int min = limits[i].first;
+                int max = x[i];
+                const int upperEnd = max;
+                int gallopDirection = gallopDirectionFor(i);
+                long long gallopStep = 1;
+                while ((long long)max-min>searchTolerance(i)) {
+                    if (mustStop()) {
+                        nofSearchCallsPerDimension[i] += nofOracleCalls-nofCallsBefore;
+                        return false;
+                    }
+                    const long long rangeSize = (long long)max-min;
+                    const size_t maxNofProbes = (size_t)std::min((long long)std::min(searchArity,oracleCallBudget-nofOracleCalls),rangeSize);
+                    probeValues.clear();
+                    if (gallopDirection==0) {
+                        for (size_t j=1;j<=maxNofProbes;j++) {
+                            probeValues.push_back((int)(min+(j*rangeSize)/(maxNofProbes+1)));
+                        }
+                    } else {
+                        // The distances from "max" downwards or from "min-1" upwards double from probe to probe and
+                        // from round to round. The last one is cut off at the end of the range.
+                        while (probeValues.size()<maxNofProbes) {
+                            const long long distance = std::min(gallopStep,rangeSize);
+                            probeValues.push_back((gallopDirection<0)?(int)(max-distance):(int)(min-1+distance));
+                            if (distance==rangeSize) break;
+                            gallopStep *= 2;
+                        }
+                        if (gallopDirection<0) std::reverse(probeValues.begin(),probeValues.end());
+                    }
+                    const size_t nofProbes = probeValues.size();
+
+                    // Probes up to the largest one that is covered by the negative result buffer are infeasible, and
+                    // probes from the smallest one that is covered by the positive result buffer on are feasible.
+                    size_t firstUnknownProbe = nofProbes;
+                    while ((firstUnknownProbe>0) && !isCoveredNegatively(i,probeValues[firstUnknownProbe-1])) firstUnknownProbe--;
+                    size_t firstKnownFeasibleProbe = firstUnknownProbe;
+                    while ((firstKnownFeasibleProbe<nofProbes) && !isCoveredPositively(i,probeValues[firstKnownFeasibleProbe])) firstKnownFeasibleProbe++;
+                    probe.clear();
+                    for (size_t j=firstUnknownProbe;j<firstKnownFeasibleProbe;j++) {
+                        x[i] = probeValues[j];
+                        probe.push_back(x.data());
+                    }
+                    if (!probe.empty()) evaluate(probe,probeResult,true);
+
+                    // Narrow down the range by the smallest feasible probe.
+                    size_t firstFeasibleProbe = firstUnknownProbe;
+                    while ((firstFeasibleProbe<firstKnownFeasibleProbe) && !probeResult[firstFeasibleProbe-firstUnknownProbe]) firstFeasibleProbe++;
+                    if (firstFeasibleProbe<nofProbes) max = probeValues[firstFeasibleProbe];
+                    if (firstFeasibleProbe>0) min = probeValues[firstFeasibleProbe-1]+1;
+                    if (((gallopDirection<0) && (firstFeasibleProbe>0)) || ((gallopDirection>0) && (firstFeasibleProbe<nofProbes))) gallopDirection = 0;
+                    // Only the largest infeasible and the smallest feasible probe needs to be buffered, as they dominate
+                    // the other ones.
+                    if (firstFeasibleProbe>firstUnknownProbe) addInfeasiblePoint(probe[firstFeasibleProbe-firstUnknownProbe-1]);
+                    if (firstFeasibleProbe<firstKnownFeasibleProbe) positiveResultBuffer.addPoint(probe[firstFeasibleProbe-firstUnknownProbe]);
+                }
+                x[i] = max;
+                nofSearchCallsPerDimension[i] += nofOracleCalls-nofCallsBefore;
+                if ((long long)max-limits[i].first<(long long)upperEnd-max) nofResultsNearerToLowerLimit[i]++;
+                if ((long long)max-limits[i].first>(long long)upperEnd-max) nofResultsNearerToLowerLimit[i]--;
+            }
+            stats.recordParetoPoint();
+            addParetoPoint();
+            return true;
+        }
+
+        /**
+         * @brief Adds "x" to the Pareto front
+         *
+         * Once the co-Pareto elements are split by a Pareto point, no point that is tested later is greater than or equal
+         * to it, so the feasible points that are greater than or equal to it are of no further use to the positive result
+         * buffer. It only keeps the Pareto point when there is a Pareto front in which the point is stored anyway, and
+         * otherwise, a run with a sink would keep the whole Pareto front in the buffer.
+         */
+        void addParetoPoint() {
+            if (paretoFront!=NULL) {
+                positiveResultBuffer.addPoint(x.data());
+            } else {
+                positiveResultBuffer.removeGeq(x.data());
+            }
+            if (hypervolume) hypervolume->addParetoPoint(x.data());
+            if (!paretoPointLogSizeAtChunk.empty()) paretoPointLog.push_back(x.data());
+            if (paretoFront!=NULL) paretoFront->push_back(x.data());
+            if (paretoPointSink!=NULL) {
+                sinkPoint.assign(x.begin(),x.end());
+                (*paretoPointSink)(sinkPoint);
+            }
+        }
+
+        /**
+         * @brief Adds a point that is known to be infeasible to the negative result buffer
+         */
+        void addInfeasiblePoint(const int *point) {
+            negativeResultBuffer.addPoint(point);
+            if (hypervolume) hypervolume->addInfeasiblePoint(point);
+        }
+
+        void reportHypervolume() {
+            if (hypervolumeProgress) hypervolumeProgress(hypervolume->getBound());
+        }
+
+        /**
+         * @brief Starts a run from what "warmStart" knows instead of from the maximal point
+         *
+         * The seeds for Pareto points are taken in lexicographic order, for which updating the co-Pareto elements is
+         * several times faster than for a random order in four and more dimensions.
+         */
+        void applyWarmStart() {
+            const PointSet *sets[3] = {&warmStart->paretoPoints,&warmStart->negativePoints,&warmStart->coParetoElements};
+            for (auto set : sets) {
+                if (set->empty()) continue;
+                if (set->dimensions()!=nofDimensions) throw "Error: The points of the warm start need to have the same dimension as the limits.";
+                for (size_t i=0;i<set->size();i++) {
+                    for (unsigned int d=0;d<nofDimensions;d++) {
+                        if (((*set)[i][d]<limits[d].first) || ((*set)[i][d]>limits[d].second)) throw "Error: The points of the warm start need to be within the limits.";
+                    }
+                }
+            }
+
+            PointSet points(nofDimensions);
+            if (warmStart->coParetoElements.empty()) {
+                for (unsigned int i=0;i<nofDimensions;i++) x[i] = limits[i].second;
+                coParetoElements.insert(x.data());
+            } else {
+                getMaximalPoints(warmStart->coParetoElements,points);
+                for (size_t i=0;i<points.size();i++) coParetoElements.insert(points[i]);
+            }
+            if (!warmStart->negativePoints.empty()) {
+                points.clear();
+                getMaximalPoints(warmStart->negativePoints,points);
+                negativeResultBuffer.addMaximalPoints(points);
+                if (hypervolume) {
+                    for (size_t i=0;i<points.size();i++) hypervolume->addInfeasiblePoint(points[i]);
+                }
+            }
+            if (warmStart->paretoPoints.empty()) return;
+
+            // Equal seeds survive "cleanParetoFront", but each of them may only be added or evaluated once
+            PointSet seeds = cleanParetoFront(warmStart->paretoPoints);
+            sortPointsAndRemoveDuplicates(seeds);
+
+            if (warmStart->trustParetoPoints) {
+                for (size_t i=0;i<seeds.size();i++) {
+                    std::copy(seeds[i],seeds[i]+nofDimensions,x.begin());
+                    addParetoPoint();
+                    dominatedElements.clear();
+                    stats.updateCoParetoElements(coParetoElements,splitPointFor(x.data()),limits,dominatedElements,children);
+                }
+                return;
+            }
+
+            // Evaluate the seeds. As they form an antichain, the points in a batch do not imply results for each other.
+            PointSet feasibleSeeds(nofDimensions);
+            size_t next = 0;
+            while ((next<seeds.size()) && !mustStop()) {
+                batch.clear();
+                const size_t maxBatchSize = std::min(oracle.maxBatchSize(),oracleCallBudget-nofOracleCalls);
+                for (;(next<seeds.size()) && (batch.size()<maxBatchSize);next++) {
+                    const int *seed = seeds[next];
+                    if (stats.isCoveredNegatively(negativeResultBuffer,seed)) continue;
+                    if (positiveResultBuffer.isContained(seed)) {
+                        feasibleSeeds.push_back(seed);
+                    } else {
+                        batch.push_back(seed);
+                    }
+                }
+                if (batch.empty()) continue;
+                evaluate(batch,results,false);
+                for (size_t j=0;j<batch.size();j++) {
+                    if (results[j]) {
+                        positiveResultBuffer.addPoint(batch[j]);
+                        feasibleSeeds.push_back(batch[j]);
+                    } else {
+                        addInfeasiblePoint(batch[j]);
+                    }
+                }
+            }
+
+            // Find a Pareto point below every feasible seed that has not been covered by the Pareto points found so far
+            verifyingSeeds = true;
+            for (size_t i=0;i<feasibleSeeds.size();i++) {
+                if (coParetoElements.containsGeq(feasibleSeeds[i])) {
+                    if (!findParetoPoint(feasibleSeeds[i])) break;
+                    dominatedElements.clear();
+                    stats.updateCoParetoElements(coParetoElements,splitPointFor(x.data()),limits,dominatedElements,children);
+                }
+            }
+            verifyingSeeds = false;
+        }
+
+        bool isCoveredNegatively(unsigned int dimension, int value) {
+            x[dimension] = value;
+            return stats.isCoveredNegatively(negativeResultBuffer,x.data());
+        }
+
+        bool isCoveredPositively(unsigned int dimension, int value) {
+            x[dimension] = value;
+            return positiveResultBuffer.isContained(x.data());
+        }
+
+    public:
+        ParetoEnumerator(Oracle &_oracle, const std::vector<std::pair<int,int> > &_limits, PointSet *_paretoFront, const std::function<void(const std::vector<int> &)> *_paretoPointSink, const EnumerationOptions &options) :
+            limits(_limits), nofDimensions(_limits.size()), oracle(_oracle), stats(options.stats), paretoFront(_paretoFront), paretoPointSink(_paretoPointSink),
+            coParetoElements(_limits,options,[this](const int *point) { return hypervolume->undecidedVolumeBelow(point); }),
+            negativeResultBuffer(_limits,options.packCoordinates), positiveResultBuffer(_limits,options.packCoordinates),
+            batch(nofDimensions), feasibleElements(nofDimensions), probe(nofDimensions),
+            searchArity(std::max(size_t(1),std::min(size_t(options.searchArity),oracle.maxBatchSize()))),
+            valueSearch(options.valueSearch), nofResultsNearerToLowerLimit(nofDimensions,0), dimensionOrder(options.dimensionOrder), searchOrder(nofDimensions), nofSearchCallsPerDimension(nofDimensions,0), nofSearches(0),
+            dominatedElements(nofDimensions), children(nofDimensions), x(PointStorage<N>::make(nofDimensions)),
+            resumed(false), stateFile(options.stateFile), stateFileSaveInterval(options.stateFileSaveInterval), initialState(options.initialState),
+            finalState(options.finalState), warmStart(options.warmStart), verifyingSeeds(false), stopToken(options.stopToken), timeBudget(options.timeBudget), oracleCallBudget(options.oracleCallBudget),
+            nofOracleCalls(0), stopped(false), oracleCache(options.oracleCache), uncachedPoints(nofDimensions),
+            memoryLimit(options.memoryLimit), spillDirectory(options.spillDirectory), paretoPointLog(nofDimensions), nofNegativePointsAfterSpill(0), spilledPoints(nofDimensions),
+            approximationTolerance(options.approximationTolerance), splitPoint(nofDimensions),
+            hypervolumeProgress(options.hypervolumeProgress), hypervolumeTarget(options.hypervolumeTarget) {
+            if ((oracleCache!=NULL) && (oracleCache->dimensions()!=nofDimensions)) throw "Error: The oracle cache is for a different number of dimensions.";
+            if (!approximationTolerance.empty()) {
+                if (approximationTolerance.size()!=nofDimensions) throw "Error: The approximation tolerance needs to have one value per dimension.";
+                for (int tolerance : approximationTolerance) {
+                    if (tolerance<0) throw "Error: The approximation tolerance must not be negative.";
+                }
+            }
+            if ((options.selection==SELECT_LARGEST_GAP_FIRST) || hypervolumeProgress || (hypervolumeTarget<1.0)) {
+                hypervolume.reset(new HypervolumeTracker<N>(limits));
+            }
+        }
+
+        /**
+         * @brief The point by which a point that has been found splits the co-Pareto elements: the point itself, or, when
+         * approximating, the point lowered by the tolerances, but not below the lower limits
+         */
+        const int *splitPointFor(const int *point) {
+            if (approximationTolerance.empty()) return point;
+            for (unsigned int i=0;i<nofDimensions;i++) {
+                splitPoint[i] = (int)std::max((long long)limits[i].first,(long long)point[i]-approximationTolerance[i]);
+            }
+            return splitPoint.data();
+        }
+
+        /**
+         * @brief The difference between the largest and the smallest candidate value up to which the search for the
+         * smallest feasible value in a dimension goes on
+         */
+        long long searchTolerance(unsigned int dimension) const {
+            return approximationTolerance.empty()?0:approximationTolerance[dimension];
+        }
+
+        size_t memoryUsage() const {
+            return coParetoElements.memoryUsage()+negativeResultBuffer.memoryUsage()+positiveResultBuffer.memoryUsage();
+        }
+
+        bool hasSpilledCoParetoElements() const {
+            return !paretoPointLogSizeAtChunk.empty();
+        }
+
+        /**
+         * @brief Moves co-Pareto elements and infeasible points to the spill files if the run takes more memory than
+         * allowed. Half of the co-Pareto elements are kept, namely those that would be tested next, and the infeasible
+         * points that cover one of them. The infeasible points are only spilled if their number has more than doubled
+         * since the last time, so that points that are kept are not checked over and over again.
+         */
+        void spillIfNeeded() {
+            if ((memoryLimit==std::numeric_limits<size_t>::max()) || (memoryUsage()<=memoryLimit)) return;
+            if (coParetoElements.size()>=2) {
+                spilledPoints.clear();
+                coParetoElements.removeAllBut(coParetoElements.size()/2,spilledPoints);
+                if (!coParetoSpillFile) coParetoSpillFile.reset(new SpillFile(nofDimensions,spillDirectory));
+                coParetoSpillFile->append(spilledPoints);
+                paretoPointLogSizeAtChunk.push_back(paretoPointLog.size());
+                stats.recordSpill(spilledPoints.size(),0);
+            }
+            if ((memoryUsage()>memoryLimit) && (negativeResultBuffer.size()>2*nofNegativePointsAfterSpill)) {
+                PointSet points(nofDimensions);
+                negativeResultBuffer.extractAll(points);
+                PointSet kept(nofDimensions);
+                spilledPoints.clear();
+                for (size_t i=0;i<points.size();i++) (coParetoElements.containsLeq(points[i])?kept:spilledPoints).push_back(points[i]);
+                negativeResultBuffer.addMaximalPoints(kept);
+                nofNegativePointsAfterSpill = kept.size();
+                if (!spilledPoints.empty()) {
+                    if (!negativeSpillFile) negativeSpillFile.reset(new SpillFile(nofDimensions,spillDirectory));
+                    negativeSpillFile->append(spilledPoints);
+                    stats.recordSpill(0,spilledPoints.size());
+                }
+            }
+        }
+
+        /**
+         * @brief Applies the Pareto points from "paretoPointLog", starting with the given one, to "elements"
+         */
+        template<class Updater> void applyLoggedParetoPoints(CoParetoSet<N> &elements, size_t firstParetoPoint, Updater &updater) {
+            for (size_t i=firstParetoPoint;i<paretoPointLog.size();i++) {
+                dominatedElements.clear();
+                updater.updateCoParetoElements(elements,splitPointFor(paretoPointLog[i]),limits,dominatedElements,children);
+            }
+        }
+
+        /**
+         * @brief Takes the last chunk of spilled co-Pareto elements back, which is called when there are no co-Pareto
+         * elements in memory. The elements are updated for the Pareto points found since they were spilled, and the
+         * ones that are covered by a spilled infeasible point are dropped.
+         */
+        void takeBackSpilledCoParetoElements() {
+            spilledPoints.clear();
+            coParetoSpillFile->popLast(spilledPoints);
+            for (size_t i=0;i<spilledPoints.size();i++) coParetoElements.insert(spilledPoints[i]);
+            applyLoggedParetoPoints(coParetoElements,paretoPointLogSizeAtChunk.back(),stats);
+            paretoPointLogSizeAtChunk.pop_back();
+            if (paretoPointLogSizeAtChunk.empty()) paretoPointLog.clear();
+            if (negativeSpillFile) {
+                for (size_t chunk=0;chunk<negativeSpillFile->nofChunks();chunk++) {
+                    spilledPoints.clear();
+                    negativeSpillFile->read(chunk,spilledPoints);
+                    for (size_t i=0;i<spilledPoints.size();i++) coParetoElements.removeLeq(spilledPoints[i]);
+                }
+            }
+        }
+
+        /**
+         * @brief Copies what is known at the end of a round or of the run to "state"
+         */
+        void getState(EnumerationState &state) {
+            state.limits = limits;
+            state.approximationTolerance = approximationTolerance;
+            PointSet *sets[4] = {&state.paretoFront,&state.coParetoElements,&state.negativePoints,&state.positivePoints};
+            for (auto set : sets) PointSet(nofDimensions).swap(*set);
+            if (paretoFront!=NULL) state.paretoFront = *paretoFront;
+            coParetoElements.getPoints(state.coParetoElements);
+            negativeResultBuffer.getPoints(state.negativePoints);
+            positiveResultBuffer.getPoints(state.positivePoints);
+
+            // Spilled points are read without taking them back. Updating the co-Pareto elements of every chunk separately
+            // can leave some of them below others, so only the maximal ones are kept.
+            if (hasSpilledCoParetoElements()) {
+                NoStatsRecorder updater(NULL);
+                for (size_t chunk=0;chunk<coParetoSpillFile->nofChunks();chunk++) {
+                    CoParetoSet<N> chunkElements(limits,EnumerationOptions());
+                    spilledPoints.clear();
+                    coParetoSpillFile->read(chunk,spilledPoints);
+                    for (size_t i=0;i<spilledPoints.size();i++) chunkElements.insert(spilledPoints[i]);
+                    applyLoggedParetoPoints(chunkElements,paretoPointLogSizeAtChunk[chunk],updater);
+                    chunkElements.getPoints(state.coParetoElements);
+                }
+                const PointSet points = state.coParetoElements;
+                getMaximalPoints(points,state.coParetoElements);
+            }
+            if (negativeSpillFile) {
+                for (size_t chunk=0;chunk<negativeSpillFile->nofChunks();chunk++) negativeSpillFile->read(chunk,state.negativePoints);
+                const PointSet points = state.negativePoints;
+                getMaximalPoints(points,state.negativePoints);
+            }
+        }
+
+        /**
+         * @brief Continues from a state of an earlier run. Must be called before "run", with a state for the same limits.
+         * The Pareto points of the state are passed on as if they had been found in this run.
+         */
+        void setState(const EnumerationState &state) {
+            if (paretoFront!=NULL) *paretoFront = state.paretoFront;
+            if (paretoPointSink!=NULL) {
+                for (size_t i=0;i<state.paretoFront.size();i++) (*paretoPointSink)(state.paretoFront.point(i));
+            }
+            if (hypervolume) {
+                for (size_t i=0;i<state.paretoFront.size();i++) hypervolume->addParetoPoint(state.paretoFront[i]);
+            }
+            for (size_t i=0;i<state.negativePoints.size();i++) addInfeasiblePoint(state.negativePoints[i]);
+            for (size_t i=0;i<state.coParetoElements.size();i++) coParetoElements.insert(state.coParetoElements[i]);
+            for (size_t i=0;i<state.positivePoints.size();i++) positiveResultBuffer.addPoint(state.positivePoints[i]);
+            resumed = true;
+        }
+
+        /**
+         * @brief Continues from a state. The Pareto points of a state of an approximation with other tolerances are not the
+         * ones that this run would find, so such a state is refined first.
+         */
+        void continueFrom(const EnumerationState &state) {
+            if (state.approximationTolerance.empty() || (state.approximationTolerance==approximationTolerance)) {
+                setState(state);
+            } else {
+                EnumerationState refinedState;
+                refineEnumerationState(state,refinedState);
+                setState(refinedState);
+            }
+        }
+
+        void saveState() {
+            EnumerationState state;
+            getState(state);
+            saveEnumerationState(stateFile,state);
+            lastStateFileSave = std::chrono::steady_clock::now();
+        }
+
+        void run() {
+            stats.startRun();
+            runStart = std::chrono::steady_clock::now();
+            if (initialState!=NULL) {
+                if (initialState->limits!=limits) throw "Error: The initial state of the enumeration is for different limits.";
+                continueFrom(*initialState);
+            } else if (!stateFile.empty() && !resumed) {
+                EnumerationState state;
+                if (loadEnumerationState(stateFile,state) && (state.limits==limits)) continueFrom(state);
+            }
+
+            if (!resumed) {
+                if (paretoFront!=NULL) PointSet(nofDimensions).swap(*paretoFront);
+
+                if (warmStart!=NULL) {
+                    applyWarmStart();
+                } else {
+                    // Add the maximal element to the coParetoElements
+                    for (unsigned int i=0;i<nofDimensions;i++) {
+                        x[i] = limits[i].second;
+                    }
+                    coParetoElements.insert(x.data());
+                }
+            }
+
+            // Main loop
+            typename PointStorage<N>::Point testPoint = PointStorage<N>::make(nofDimensions);
+            lastStateFileSave = std::chrono::steady_clock::now();
+            while (!coParetoElements.empty() || hasSpilledCoParetoElements()) {
+                if (coParetoElements.empty()) {
+                    takeBackSpilledCoParetoElements();
+                    continue;
+                }
+                if (!stateFile.empty() && (std::chrono::duration<double>(std::chrono::steady_clock::now()-lastStateFileSave).count()>=stateFileSaveInterval)) {
+                    saveState();
+                }
+
+                stats.recordSizes(coParetoElements.size(),negativeResultBuffer.size(),memoryUsage());
+                spillIfNeeded();
+                if (mustStop()) break;
+
+                // Collect co-Pareto elements whose feasibility is unknown. The ones that are known to be infeasible are
+                // dropped, and the ones that are known to be feasible are processed without calling the feasibility function.
+                batch.clear();
+                feasibleElements.clear();
+                const size_t maxBatchSize = std::min(oracle.maxBatchSize(),oracleCallBudget-nofOracleCalls);
+                while ((batch.size()<maxBatchSize) && !coParetoElements.empty()) {
+                    coParetoElements.pop(testPoint.data());
+                    if (!stats.isCoveredNegatively(negativeResultBuffer,testPoint.data())) {
+                        if (positiveResultBuffer.isContained(testPoint.data())) {
+                            feasibleElements.push_back(testPoint.data());
+                        } else {
+                            batch.push_back(testPoint.data());
+                        }
+                    }
+                }
+
+                if (!batch.empty()) {
+                    evaluate(batch,results,false);
+                    for (size_t j=0;j<batch.size();j++) {
+                        if (results[j]) {
+                            positiveResultBuffer.addPoint(batch[j]);
+                            feasibleElements.push_back(batch[j]);
+                        } else {
+                            addInfeasiblePoint(batch[j]);
+                        }
+                    }
+                }
+                for (size_t j=0;j<feasibleElements.size();j++) {
+                    coParetoElements.insert(feasibleElements[j]);
+                }
+
+                for (size_t j=0;j<feasibleElements.size();j++) {
+                    // As the co-Pareto elements form an antichain, the point is still in it if some element is
+                    // greater than or equal to it.
+                    if (coParetoElements.containsGeq(feasibleElements[j])) {
+                        // A Pareto point is missing. Let us find where exactly it is. If the run has to stop before,
+                        // the feasible elements are still co-Pareto elements.
+                        if (!findParetoPoint(feasibleElements[j])) break;
+
+                        // Now update all points in the coParetoFront
+                        dominatedElements.clear();
+                        stats.updateCoParetoElements(coParetoElements,splitPointFor(x.data()),limits,dominatedElements,children);
+                    }
+                }
+                stats.recordSizes(coParetoElements.size(),negativeResultBuffer.size(),memoryUsage());
+                reportHypervolume();
+            }
+            if (!stateFile.empty()) saveState();
+            reportHypervolume();
+            if (finalState!=NULL) getState(*finalState);
+            stats.finishRun(nofSearchCallsPerDimension);
+        }
+    };
+
+
+    // The feasibility functions of the variants of the main function for std::function objects
+    typedef std::function<bool(const std::vector<int> &)> PointFunction;
+    typedef std::function<std::vector<bool>(const PointBatch &)> BatchFunction;
+    typedef std::function<std::future<bool>(const std::vector<int> &)> AsyncPointFunction;
+
+    /**
+     * @brief Whether there are enumerators for fixed numbers of dimensions for an oracle. Each of them is an instantiation
+     * of its own, so there are only ones for the oracles of the variants of the main function for std::function objects,
+     * which "pareto_enumerator.cpp" instantiates explicitly. The template variants of the main function use the generic
+     * enumerator, so that it is only compiled once for every type of "fn".
+     */
+    template<class Oracle> struct HasFixedDimensionEnumerators : std::false_type {};
+    template<> struct HasFixedDimensionEnumerators<SinglePointOracle<PointFunction> > : std::true_type {};
+    template<> struct HasFixedDimensionEnumerators<ParallelOracle<PointFunction> > : std::true_type {};
+    template<> struct HasFixedDimensionEnumerators<BatchOracle<BatchFunction> > : std::true_type {};
+    template<> struct HasFixedDimensionEnumerators<AsyncOracle<AsyncPointFunction> > : std::true_type {};
+
+    /**
+     * @brief Runs the enumeration with an enumerator for a fixed number of dimensions if there is one, and with the
+     * generic one otherwise. There are ones for 3 to 6 dimensions.
+     */
+    template<class Oracle, class Stats> void runEnumerator(Oracle &oracle, const std::vector<std::pair<int,int> > &limits, PointSet *paretoFront, const std::function<void(const std::vector<int> &)> *paretoPointSink, const EnumerationOptions &options, std::true_type) {
+        switch (limits.size()) {
+        case 3: ParetoEnumerator<3,Oracle,Stats>(oracle,limits,paretoFront,paretoPointSink,options).run(); break;
+        case 4: ParetoEnumerator<4,Oracle,Stats>(oracle,limits,paretoFront,paretoPointSink,options).run(); break;
+        case 5: ParetoEnumerator<5,Oracle,Stats>(oracle,limits,paretoFront,paretoPointSink,options).run(); break;
+        case 6: ParetoEnumerator<6,Oracle,Stats>(oracle,limits,paretoFront,paretoPointSink,options).run(); break;
+        default: ParetoEnumerator<0,Oracle,Stats>(oracle,limits,paretoFront,paretoPointSink,options).run();
+        }
+    }
+
+    template<class Oracle, class Stats> void runEnumerator(Oracle &oracle, const std::vector<std::pair<int,int> > &limits, PointSet *paretoFront, const std::function<void(const std::vector<int> &)> *paretoPointSink, const EnumerationOptions &options, std::false_type) {
+        ParetoEnumerator<0,Oracle,Stats>(oracle,limits,paretoFront,paretoPointSink,options).run();
+    }
+
+    template<class Oracle, class Stats> void runEnumerator(Oracle &oracle, const std::vector<std::pair<int,int> > &limits, PointSet *paretoFront, const std::function<void(const std::vector<int> &)> *paretoPointSink, const EnumerationOptions &options) {
+        runEnumerator<Oracle,Stats>(oracle,limits,paretoFront,paretoPointSink,options,HasFixedDimensionEnumerators<Oracle>());
+    }
+
+    // Compiled in "pareto_enumerator.cpp"
+    extern template void runEnumerator<SinglePointOracle<PointFunction>,StatsRecorder>(SinglePointOracle<PointFunction> &, const std::vector<std::pair<int,int> > &, PointSet *, const std::function<void(const std::vector<int> &)> *, const EnumerationOptions &);
+    extern template void runEnumerator<SinglePointOracle<PointFunction>,NoStatsRecorder>(SinglePointOracle<PointFunction> &, const std::vector<std::pair<int,int> > &, PointSet *, const std::function<void(const std::vector<int> &)> *, const EnumerationOptions &);
+    extern template void runEnumerator<ParallelOracle<PointFunction>,StatsRecorder>(ParallelOracle<PointFunction> &, const std::vector<std::pair<int,int> > &, PointSet *, const std::function<void(const std::vector<int> &)> *, const EnumerationOptions &);
+    extern template void runEnumerator<ParallelOracle<PointFunction>,NoStatsRecorder>(ParallelOracle<PointFunction> &, const std::vector<std::pair<int,int> > &, PointSet *, const std::function<void(const std::vector<int> &)> *, const EnumerationOptions &);
+    extern template void runEnumerator<BatchOracle<BatchFunction>,StatsRecorder>(BatchOracle<BatchFunction> &, const std::vector<std::pair<int,int> > &, PointSet *, const std::function<void(const std::vector<int> &)> *, const EnumerationOptions &);
+    extern template void runEnumerator<BatchOracle<BatchFunction>,NoStatsRecorder>(BatchOracle<BatchFunction> &, const std::vector<std::pair<int,int> > &, PointSet *, const std::function<void(const std::vector<int> &)> *, const EnumerationOptions &);
+    extern template void runEnumerator<AsyncOracle<AsyncPointFunction>,StatsRecorder>(AsyncOracle<AsyncPointFunction> &, const std::vector<std::pair<int,int> > &, PointSet *, const std::function<void(const std::vector<int> &)> *, const EnumerationOptions &);
+    extern template void runEnumerator<AsyncOracle<AsyncPointFunction>,NoStatsRecorder>(AsyncOracle<AsyncPointFunction> &, const std::vector<std::pair<int,int> > &, PointSet *, const std::function<void(const std::vector<int> &)> *, const EnumerationOptions &);
+
+    /**
+     * @brief Runs the enumeration with statistics if they are requested in the options. Otherwise, the enumerator does
+     * not contain any code for collecting them. This compiles the enumerator twice for every oracle.
+     */
+    struct WithStatsIfRequested {
+        template<class Oracle> static void run(Oracle &oracle, const std::vector<std::pair<int,int> > &limits, PointSet *paretoFront, const std::function<void(const std::vector<int> &)> *paretoPointSink, const EnumerationOptions &options) {
+            if (options.stats!=NULL) {
+                runEnumerator<Oracle,StatsRecorder>(oracle,limits,paretoFront,paretoPointSink,options);
+            } else {
+                runEnumerator<Oracle,NoStatsRecorder>(oracle,limits,paretoFront,paretoPointSink,options);
+            }
+        }
+    };
+
+    /**
+     * @brief Runs the enumeration without statistics, for callers that have dealt with requests for them before
+     */
+    struct WithoutStats {
+        template<class Oracle> static void run(Oracle &oracle, const std::vector<std::pair<int,int> > &limits, PointSet *paretoFront, const std::function<void(const std::vector<int> &)> *paretoPointSink, const EnumerationOptions &options) {
+            runEnumerator<Oracle,NoStatsRecorder>(oracle,limits,paretoFront,paretoPointSink,options);
+        }
+    };
+
+    /**
+     * @brief Runs the enumeration with the oracle that fits the settings. This variant is chosen for feasibility
+     * functions that take single points.
+     */
+    template<class Runner, class F> auto runEnumeration(F &fn, const std::vector<std::pair<int,int> > &limits, PointSet *paretoFront, const std::function<void(const std::vector<int> &)> *paretoPointSink, const EnumerationOptions &options, int) -> decltype(static_cast<bool>(fn(std::declval<const std::vector<int> &>())),void()) {
+        if (options.nofThreads>1) {
+            ParallelOracle<F> oracle(fn,limits.size(),options.nofThreads);
+            Runner::run(oracle,limits,paretoFront,paretoPointSink,options);
+        } else {
+            SinglePointOracle<F> oracle(fn,limits.size());
+            Runner::run(oracle,limits,paretoFront,paretoPointSink,options);
+        }
+    }
+
+    /**
+     * @brief Variant of "runEnumeration" for feasibility functions that return a future for the result for a single point
+     */
+    template<class Runner, class F> auto runEnumeration(F &fn, const std::vector<std::pair<int,int> > &limits, PointSet *paretoFront, const std::function<void(const std::vector<int> &)> *paretoPointSink, const EnumerationOptions &options, int) -> decltype(static_cast<bool>(fn(std::declval<const std::vector<int> &>()).get()),void()) {
+        AsyncOracle<F> oracle(fn,limits.size(),options.maxBatchSize);
+        Runner::run(oracle,limits,paretoFront,paretoPointSink,options);
+    }
+
+    /**
+     * @brief Variant of "runEnumeration" for feasibility functions that take batches of points
+     */
+    template<class Runner, class F> void runEnumeration(F &fn, const std::vector<std::pair<int,int> > &limits, PointSet *paretoFront, const std::function<void(const std::vector<int> &)> *paretoPointSink, const EnumerationOptions &options, long) {
+        BatchOracle<F> oracle(fn,options.maxBatchSize);
+        Runner::run(oracle,limits,paretoFront,paretoPointSink,options);
+    }
+
+    template<class F> void runEnumeration(F &fn, const std::vector<std::pair<int,int> > &limits, PointSet *paretoFront, const std::function<void(const std::vector<int> &)> *paretoPointSink, const EnumerationOptions &options) {
+        runEnumeration<WithStatsIfRequested>(fn,limits,paretoFront,paretoPointSink,options,0);
+    }
+
+    /**
+     * @brief Runs an enumeration that requests statistics through the variants of the main function for std::function
+     * objects, which the library compiles with the code for collecting them. This variant is chosen for feasibility
+     * functions that take single points.
+     */
+    template<class F> auto runEnumerationWithLibraryStats(F &fn, const std::vector<std::pair<int,int> > &limits, PointSet *paretoFront, const std::function<void(const std::vector<int> &)> *paretoPointSink, const EnumerationOptions &options, int) -> decltype(static_cast<bool>(fn(std::declval<const std::vector<int> &>())),void()) {
+        PointFunction function = [&fn](const std::vector<int> &point) { return static_cast<bool>(fn(point)); };
+        if (paretoFront!=NULL) {
+            enumerateParetoFront(function,limits,*paretoFront,options);
+        } else {
+            enumerateParetoFront(function,limits,*paretoPointSink,options);
+        }
+    }
+
+    /**
+     * @brief Variant of "runEnumerationWithLibraryStats" for feasibility functions that return a future for the result
+     * for a single point. The results are passed on as deferred futures, so the calls of "fn" still overlap.
+     */
+    template<class F> auto runEnumerationWithLibraryStats(F &fn, const std::vector<std::pair<int,int> > &limits, PointSet *paretoFront, const std::function<void(const std::vector<int> &)> *paretoPointSink, const EnumerationOptions &options, int) -> decltype(static_cast<bool>(fn(std::declval<const std::vector<int> &>()).get()),void()) {
+        AsyncPointFunction function = [&fn](const std::vector<int> &point) -> std::future<bool> {
+            typedef decltype(fn(point)) Future;
+            return std::async(std::launch::deferred,[](Future &&result) { return static_cast<bool>(result.get()); },fn(point));
+        };
+        if (paretoFront!=NULL) {
+            enumerateParetoFront(function,limits,*paretoFront,options);
+        } else {
+            enumerateParetoFront(function,limits,*paretoPointSink,options);
+        }
+    }
+
+    /**
+     * @brief Variant of "runEnumerationWithLibraryStats" for feasibility functions that take batches of points
+     */
+    template<class F> void runEnumerationWithLibraryStats(F &fn, const std::vector<std::pair<int,int> > &limits, PointSet *paretoFront, const std::function<void(const std::vector<int> &)> *paretoPointSink, const EnumerationOptions &options, long) {
+        BatchFunction function = [&fn](const PointBatch &points) -> std::vector<bool> { return fn(points); };
+        if (paretoFront!=NULL) {
+            enumerateParetoFront(function,limits,*paretoFront,options);
+        } else {
+            enumerateParetoFront(function,limits,*paretoPointSink,options);
+        }
+    }
+
+    /**
+     * @brief Runs the enumeration for the template variants of the main function. Unless PARETO_ENUMERATOR_INLINE_STATS
+     * is defined, only the variant of the enumerator without statistics is compiled for "fn", and runs that request
+     * statistics call "fn" through a std::function instead.
+     */
+    template<class F> void runTemplateEnumeration(F &fn, const std::vector<std::pair<int,int> > &limits, PointSet *paretoFront, const std::function<void(const std::vector<int> &)> *paretoPointSink, const EnumerationOptions &options) {
+#if defined(PARETO_ENUMERATOR_INLINE_STATS)
+        runEnumeration<WithStatsIfRequested>(fn,limits,paretoFront,paretoPointSink,options,0);
+#else
+        if (options.stats!=NULL) {
+            runEnumerationWithLibraryStats(fn,limits,paretoFront,paretoPointSink,options,0);
+        } else {
+            runEnumeration<WithoutStats>(fn,limits,paretoFront,paretoPointSink,options,0);
+        }
+#endif
+    }
+
+} // End of namespace detail
+
+    template<class F> std::list<std::vector<int> > enumerateParetoFront(F &&fn, const std::vector<std::pair<int,int> > &limits, const EnumerationOptions &options) {
+        PointSet paretoFront;
+        detail::runTemplateEnumeration(fn,limits,&paretoFront,NULL,options);
+        return paretoFront.toList();
+    }
+
+    template<class F> void enumerateParetoFront(F &&fn, const std::vector<std::pair<int,int> > &limits, PointSet &paretoFront, const EnumerationOptions &options) {
+        detail::runTemplateEnumeration(fn,limits,&paretoFront,NULL,options);
+    }
+
+    template<class F> void enumerateParetoFront(F &&fn, const std::vector<std::pair<int,int> > &limits, const std::function<void(const std::vector<int> &)> &paretoPointSink, const EnumerationOptions &options) {
+        detail::runTemplateEnumeration(fn,limits,NULL,&paretoPointSink,options);
+    }
+
+    template<class F> void enumerateWorkUnit(F &&fn, const EnumerationState &workUnit, EnumerationState &result, const EnumerationOptions &options) {
+        EnumerationOptions workerOptions = options;
+        workerOptions.initialState = &workUnit;
+        workerOptions.finalState = &result;
+        PointSet paretoFront;
+        detail::runTemplateEnumeration(fn,workUnit.limits,&paretoFront,NULL,workerOptions);
+    }
+
+} // End of namespace
+
+#endif
@@ -3,6 +3,16 @@
 #include <sstream>
 #include <random>
 #include <set>
+#include <map>
+#include <algorithm>
+#include <numeric>
+#include <mutex>
+#include <future>
+#include <thread>
+#include <chrono>
+#include <atomic>
+#include <cstdio>
+#include <string>
 
 /*
  * This is
@@ -103,6 +113,37 @@ void doSimpleTest() {
     }
     if ((!foundA) || (!foundB)) throw "Error: Not all Pareto points have been found in function doSimpleTest (plus possibly 1-2 too many points)";
 
+    // Check that the variant storing the Pareto front in a PointSet yields the same points
+    paretoenumerator::PointSet frontPoints;
+    paretoenumerator::enumerateParetoFront(simpleObjectiveFunction,limits,frontPoints);
+    if ((frontPoints.size()!=front.size()) || (frontPoints.dimensions()!=3)) throw "Error: The PointSet variant of enumerateParetoFront found a different number of Pareto points in function doSimpleTest";
+    for (size_t i=0;i<frontPoints.size();i++) {
+        if (std::find(front.begin(),front.end(),frontPoints.point(i))==front.end()) throw "Error: The PointSet variant of enumerateParetoFront found a different Pareto point in function doSimpleTest";
+    }
+
+    // Check that the streaming variant yields the same points in the same order
+    std::list<std::vector<int> > streamedFront;
+    paretoenumerator::enumerateParetoFront(simpleObjectiveFunction,limits,[&streamedFront](const std::vector<int> &point) { streamedFront.push_back(point); });
+    if (streamedFront!=front) throw "Error: The streaming variant of enumerateParetoFront found different Pareto points in function doSimpleTest";
+
+    // Check that passing the feasibility function as a std::function or as a batch lambda (which both use other
+    // variants of enumerateParetoFront than a plain function) yields the same points in the same order
+    std::function<bool(const std::vector<int> &)> wrappedFunction = simpleObjectiveFunction;
+    if (paretoenumerator::enumerateParetoFront(wrappedFunction,limits)!=front) throw "Error: The std::function variant of enumerateParetoFront found different Pareto points in function doSimpleTest";
+    auto batchFunction = [](const paretoenumerator::PointBatch &points) {
+        std::vector<bool> results;
+        for (size_t i=0;i<points.size();i++) results.push_back(simpleObjectiveFunction(points.point(i)));
+        return results;
+    };
+    paretoenumerator::EnumerationOptions options;
+    options.maxBatchSize = 1;
+    if (paretoenumerator::enumerateParetoFront(batchFunction,limits,options)!=front) throw "Error: The batch variant of enumerateParetoFront found different Pareto points in function doSimpleTest";
+
+    // Check that the template variants also collect statistics
+    paretoenumerator::EnumerationStats stats;
+    options.stats = &stats;
+    if ((paretoenumerator::enumerateParetoFront(batchFunction,limits,options)!=front) || (stats.nofParetoPointsFound!=front.size())) throw "Error: The batch variant of enumerateParetoFront collected wrong statistics in function doSimpleTest";
+    if ((paretoenumerator::enumerateParetoFront(simpleObjectiveFunction,limits,options)!=front) || (stats.nofParetoPointsFound!=front.size()) || (stats.nofOracleCalls==0)) throw "Error: The template variant of enumerateParetoFront collected wrong statistics in function doSimpleTest";
 }
 
 //=================================================================================
@@ -110,16 +151,18 @@ void doSimpleTest() {
 //              -> Also check that no redundant calls to the feasibility
 //                 function are made!
 //=================================================================================
-bool randomTestFeasibilityFunction(const std::vector<int> &point, const std::list<std::vector<int> > &paretoPoints, std::list<std::vector<int> > &positiveBuffer, std::list<std::vector<int> > &negativeBuffer ) {
+bool randomTestFeasibilityFunction(const std::vector<int> &point, const std::list<std::vector<int> > &paretoPoints, std::list<std::vector<int> > &positiveBuffer, std::list<std::vector<int> > &negativeBuffer, bool checkRedundantCalls = true) {
 
-    // Check if implied by the previous positive results
-    for (auto &a : positiveBuffer) {
-        if (vectorOfIntIsLeq(a,point)) throw "Error: Called the feasibility function on a point that is already known to map to TRUE.";
-    }
+    if (checkRedundantCalls) {
+        // Check if implied by the previous positive results
+        for (auto &a : positiveBuffer) {
+            if (vectorOfIntIsLeq(a,point)) throw "Error: Called the feasibility function on a point that is already known to map to TRUE.";
+        }
 
-    // Check if implied by the previous negative results
-    for (auto &a : negativeBuffer) {
-        if (vectorOfIntIsLeq(point,a)) throw "Error: Called the feasibility function on a point that is already known to map to FALSE.";
+        // Check if implied by the previous negative results
+        for (auto &a : negativeBuffer) {
+            if (vectorOfIntIsLeq(point,a)) throw "Error: Called the feasibility function on a point that is already known to map to FALSE.";
+        }
     }
 
     for (auto &a : paretoPoints) {
@@ -132,10 +175,8 @@ bool randomTestFeasibilityFunction(const std::vector<int> &point, const std::lis
     return false;
 }
 
-void doRandomTest(unsigned int randomSeed) {
+void makeRandomProblem(unsigned int randomSeed, std::vector<std::pair<int,int> > &limits, std::list<std::vector<int> > &paretoPoints) {
     std::mt19937 rand(randomSeed);
-    std::vector<std::pair<int,int> > limits;
-    std::list<std::vector<int> > paretoPoints;
 
     // Randomize the number of dimensions
     unsigned int nofDimensions = rand() % 7 + 5;
@@ -161,6 +202,12 @@ void doRandomTest(unsigned int randomSeed) {
 
     // Clean the points
     paretoPoints = cleanParetoFront(paretoPoints);
+}
+
+void doRandomTest(unsigned int randomSeed, unsigned int maxBatchSize, unsigned int nofThreads, unsigned int searchArity = 1) {
+    std::vector<std::pair<int,int> > limits;
+    std::list<std::vector<int> > paretoPoints;
+    makeRandomProblem(randomSeed,limits,paretoPoints);
 
     // Enumerate points. The feasibility function
     // stores all results in the "positive" and "negative" Buffer
@@ -169,8 +216,56 @@ void doRandomTest(unsigned int randomSeed) {
     std::list<std::vector<int> > positiveBuffer;
     std::list<std::vector<int> > negativeBuffer;
 
-    std::function<bool(const std::vector<int> &)> fun = [paretoPoints,&positiveBuffer,&negativeBuffer] (const std::vector<int> &point) { return randomTestFeasibilityFunction(point,paretoPoints,positiveBuffer, negativeBuffer); };
-    std::list<std::vector<int> > front = paretoenumerator::enumerateParetoFront(fun,limits);
+    // With a search arity greater than 1, the enumerator makes speculative calls that may be redundant
+    bool checkRedundantCalls = searchArity==1;
+    std::function<bool(const std::vector<int> &)> fun = [paretoPoints,&positiveBuffer,&negativeBuffer,checkRedundantCalls] (const std::vector<int> &point) { return randomTestFeasibilityFunction(point,paretoPoints,positiveBuffer, negativeBuffer, checkRedundantCalls); };
+    std::list<std::vector<int> > front;
+    if (nofThreads>1) {
+        // The test feasibility function is not thread-safe, so calls to it need to be serialized.
+        std::mutex mutex;
+        std::function<bool(const std::vector<int> &)> threadSafeFun = [&fun,&mutex] (const std::vector<int> &point) {
+            std::lock_guard<std::mutex> lock(mutex);
+            return fun(point);
+        };
+        paretoenumerator::EnumerationOptions options;
+        options.nofThreads = nofThreads;
+        options.searchArity = searchArity;
+        options.valueSearch = static_cast<paretoenumerator::ValueSearch>(randomSeed % 4);
+        front = paretoenumerator::enumerateParetoFront(threadSafeFun,limits,options);
+    } else if (maxBatchSize==0) {
+        front = paretoenumerator::enumerateParetoFront(fun,limits);
+    } else {
+        // The batch feasibility function evaluates the points one after the other, so that
+        // it also detects redundant calls within a batch
+        size_t nofCalls = 0;
+        size_t nofFeasibleCalls = 0;
+        std::function<std::vector<bool>(const paretoenumerator::PointBatch &)> batchFun = [&fun,maxBatchSize,&nofCalls,&nofFeasibleCalls] (const paretoenumerator::PointBatch &points) {
+            if ((points.size()==0) || (points.size()>maxBatchSize)) throw "Error: The batch feasibility function was called with a wrong number of points.";
+            std::vector<bool> results;
+            for (size_t i=0;i<points.size();i++) results.push_back(fun(points.point(i)));
+            nofCalls += points.size();
+            nofFeasibleCalls += std::count(results.begin(),results.end(),true);
+            return results;
+        };
+        paretoenumerator::EnumerationOptions options;
+        paretoenumerator::EnumerationStats stats;
+        options.maxBatchSize = maxBatchSize;
+        options.searchArity = searchArity;
+        options.stats = &stats;
+        options.selection = static_cast<paretoenumerator::CoParetoSelection>(randomSeed % 4);
+        options.selectionPriority = [](const std::vector<int> &point) { return -static_cast<double>(point[0]); };
+        options.dimensionOrder = static_cast<paretoenumerator::DimensionOrder>((randomSeed / 4) % 4);
+        options.valueSearch = static_cast<paretoenumerator::ValueSearch>((randomSeed / 16) % 4);
+        front = paretoenumerator::enumerateParetoFront(batchFun,limits,options);
+
+        // Check that the statistics are consistent with what the feasibility function has seen
+        if ((stats.nofOracleCalls!=nofCalls) || (stats.nofFeasibleOracleCalls!=nofFeasibleCalls) || (stats.nofInfeasibleOracleCalls!=nofCalls-nofFeasibleCalls)) throw "Error: Wrong number of oracle calls in the statistics.";
+        if (stats.nofCoParetoOracleCalls+stats.nofSearchOracleCalls!=nofCalls) throw "Error: The oracle calls in the statistics do not add up.";
+        if ((stats.nofNegativeBufferHits>stats.nofNegativeBufferLookups) || (stats.nofNegativeBufferNodesVisited<stats.nofNegativeBufferLookups)) throw "Error: Inconsistent negative result buffer statistics.";
+        if ((stats.nofParetoPointsFound!=paretoPoints.size()) || (stats.nofSearchOracleCallsPerDimension.size()!=limits.size())) throw "Error: Wrong number of Pareto points or dimensions in the statistics.";
+        if (std::accumulate(stats.nofSearchOracleCallsPerDimension.begin(),stats.nofSearchOracleCallsPerDimension.end(),size_t(0))!=stats.nofSearchOracleCalls) throw "Error: The search oracle calls per dimension do not add up.";
+        if ((stats.maxNofCoParetoElements==0) || (stats.oracleTime<0.0) || (stats.bookkeepingTime<0.0) || (stats.coParetoUpdateTime>stats.bookkeepingTime)) throw "Error: Implausible statistics.";
+    }
     std::set<std::vector<int> > frontSet(front.begin(),front.end());
 
     // Compare the correct Pareto front and the actual results
@@ -180,6 +275,800 @@ void doRandomTest(unsigned int randomSeed) {
     if (frontSet.size()!=paretoPoints.size()) throw "Too many points found";
 }
 
+//=================================================================================
+// Third test: Continue enumerations from a state file
+//              -> First simulate a crash after some calls to the feasibility
+//                 function, then resume, then run again with everything known
+//=================================================================================
+void doStateFileTest(unsigned int randomSeed) {
+    std::vector<std::pair<int,int> > limits;
+    std::list<std::vector<int> > paretoPoints;
+    makeRandomProblem(randomSeed,limits,paretoPoints);
+    const char *stateFile = "pareto_enumerator_test_state.bin";
+    std::remove(stateFile);
+
+    unsigned int nofCalls = 0;
+    unsigned int nofCallsBeforeCrash = randomSeed % 50 + 1;
+    bool crash = true;
+    std::function<bool(const std::vector<int> &)> fun = [&paretoPoints,&nofCalls,&nofCallsBeforeCrash,&crash] (const std::vector<int> &point) {
+        if (crash && (nofCalls==nofCallsBeforeCrash)) throw "Simulated crash";
+        nofCalls++;
+        for (auto &a : paretoPoints) {
+            if (vectorOfIntIsLeq(a,point)) return true;
+        }
+        return false;
+    };
+
+    paretoenumerator::EnumerationOptions options;
+    options.stateFile = stateFile;
+    options.stateFileSaveInterval = 0.0;
+    try {
+        paretoenumerator::enumerateParetoFront(fun,limits,options);
+    } catch (const char *error) {
+        if (std::string(error)!="Simulated crash") throw;
+    }
+
+    crash = false;
+    std::list<std::vector<int> > front = paretoenumerator::enumerateParetoFront(fun,limits,options);
+    std::set<std::vector<int> > frontSet(front.begin(),front.end());
+    for (auto a : paretoPoints) {
+        if ((frontSet.count(a))==0) throw "Element not found in Pareto set after resuming from a state file";
+    }
+    if (frontSet.size()!=paretoPoints.size()) throw "Too many points found after resuming from a state file";
+
+    unsigned int nofCallsBefore = nofCalls;
+    front = paretoenumerator::enumerateParetoFront(fun,limits,options);
+    if (nofCalls!=nofCallsBefore) throw "Error: The feasibility function was called although all results were in the state file";
+    if (std::set<std::vector<int> >(front.begin(),front.end())!=frontSet) throw "Error: Wrong Pareto front read from a state file";
+
+    paretoenumerator::EnumerationState state;
+    if (!paretoenumerator::loadEnumerationState(stateFile,state)) throw "Error: Could not read the state file";
+    if ((state.limits!=limits) || (state.paretoFront.size()!=frontSet.size()) || !state.coParetoElements.empty()) throw "Error: Unexpected content of the state file";
+    std::remove(stateFile);
+}
+
+//=================================================================================
+// Fourth test: Clean random sets of points
+//              -> Compare against the all-pairs check, including the order of
+//                 the points and duplicate points
+//=================================================================================
+void doCleanParetoFrontTest(unsigned int randomSeed) {
+    std::mt19937 rng(randomSeed);
+    unsigned int nofDimensions = rng() % 6 + 1;
+    unsigned int nofPoints = rng() % 1000;
+    int range = rng() % 20 + 1;
+    std::list<std::vector<int> > points;
+    for (unsigned int i=0;i<nofPoints;i++) {
+        std::vector<int> point;
+        for (unsigned int j=0;j<nofDimensions;j++) point.push_back(static_cast<int>(rng() % range)-range/2);
+        points.push_back(point);
+    }
+
+    std::list<std::vector<int> > expected;
+    for (auto &it : points) {
+        bool foundLarger = false;
+        for (auto &it2 : points) {
+            foundLarger |= (vectorOfIntIsSmaller(it,it2));
+        }
+        if (!foundLarger) expected.push_back(it);
+    }
+
+    if (paretoenumerator::cleanParetoFront(points)!=expected) throw "Error: cleanParetoFront returned a wrong result.";
+    if (paretoenumerator::cleanParetoFront(points,rng() % 4 + 2)!=expected) throw "Error: cleanParetoFront returned a wrong result with several threads.";
+}
+
+//=================================================================================
+// Fifth test: Enumerate with ranges for which the algorithm packs the points
+//              -> Ranges of 1, up to 255 and up to 65535 give bit-sliced, 8-bit
+//                 and 16-bit coordinates. Compare against unpacked points.
+//=================================================================================
+void doPackedCoordinatesTest(unsigned int randomSeed) {
+    std::mt19937 rng(randomSeed);
+    const int largestRanges[4] = {1,255,65535,1000000};
+    const int largestRange = largestRanges[rng() % 4];
+    unsigned int nofDimensions = rng() % 10 + 2;
+    std::vector<std::pair<int,int> > limits;
+    for (unsigned int i=0;i<nofDimensions;i++) {
+        int min = rng() % 100 - 50;
+        int range = ((i==0) || (rng() % 2))?largestRange:(rng() % largestRange + 1);
+        limits.push_back(std::pair<int,int>(min,min+range));
+    }
+    std::list<std::vector<int> > paretoPoints;
+    unsigned int nofPoints = rng() % 15 + 1;
+    for (unsigned int i=0;i<nofPoints;i++) {
+        std::vector<int> newPoint;
+        for (unsigned int j=0;j<nofDimensions;j++) {
+            newPoint.push_back(rng() % (limits[j].second - limits[j].first + 1) + limits[j].first);
+        }
+        paretoPoints.push_back(newPoint);
+    }
+    paretoPoints = cleanParetoFront(paretoPoints);
+
+    for (bool packCoordinates : {true,false}) {
+        std::list<std::vector<int> > positiveBuffer;
+        std::list<std::vector<int> > negativeBuffer;
+        std::function<bool(const std::vector<int> &)> fun = [&paretoPoints,&positiveBuffer,&negativeBuffer] (const std::vector<int> &point) { return randomTestFeasibilityFunction(point,paretoPoints,positiveBuffer,negativeBuffer); };
+        paretoenumerator::EnumerationOptions options;
+        options.packCoordinates = packCoordinates;
+        std::list<std::vector<int> > front = paretoenumerator::enumerateParetoFront(fun,limits,options);
+        if (std::set<std::vector<int> >(front.begin(),front.end())!=std::set<std::vector<int> >(paretoPoints.begin(),paretoPoints.end())) throw "Error: Wrong Pareto front in the test with packed coordinates";
+    }
+}
+
+//=================================================================================
+// Sixth test: Stop runs early and continue them
+//              -> Split a run into runs with small oracle call budgets that
+//                 resume from the final states of each other, and check that
+//                 they make no redundant calls, also with a Pareto point sink.
+//                 Then stop a run from the feasibility function.
+//=================================================================================
+void doBudgetTest(unsigned int randomSeed) {
+    std::vector<std::pair<int,int> > limits;
+    std::list<std::vector<int> > paretoPoints;
+    makeRandomProblem(randomSeed,limits,paretoPoints);
+
+    std::list<std::vector<int> > positiveBuffer;
+    std::list<std::vector<int> > negativeBuffer;
+    size_t nofCalls = 0;
+    std::function<bool(const std::vector<int> &)> fun = [&paretoPoints,&positiveBuffer,&negativeBuffer,&nofCalls] (const std::vector<int> &point) {
+        nofCalls++;
+        return randomTestFeasibilityFunction(point,paretoPoints,positiveBuffer,negativeBuffer);
+    };
+
+    paretoenumerator::EnumerationOptions options;
+    options.oracleCallBudget = randomSeed % 50 + 1;
+    options.maxBatchSize = randomSeed % 5 + 1;
+    paretoenumerator::EnumerationState state;
+    options.finalState = &state;
+    std::list<std::vector<int> > front = paretoenumerator::enumerateParetoFront(fun,limits,options);
+    while (!state.coParetoElements.empty()) {
+        size_t nofCallsBefore = nofCalls;
+        paretoenumerator::EnumerationState previousState = state;
+        options.initialState = &previousState;
+        front = paretoenumerator::enumerateParetoFront(fun,limits,options);
+        if (nofCalls-nofCallsBefore>options.oracleCallBudget) throw "Error: The oracle call budget has been exceeded.";
+        if (front.size()<previousState.paretoFront.size()) throw "Error: A resumed run lost Pareto points.";
+    }
+    if (std::set<std::vector<int> >(front.begin(),front.end())!=std::set<std::vector<int> >(paretoPoints.begin(),paretoPoints.end())) throw "Error: Wrong Pareto front after resuming runs with oracle call budgets";
+
+    // With a Pareto point sink, the runs pass on every Pareto point once, and their states keep no feasible point that is
+    // greater than or equal to one of them
+    std::list<std::vector<int> > sunkPoints;
+    std::function<void(const std::vector<int> &)> sink = [&sunkPoints] (const std::vector<int> &point) { sunkPoints.push_back(point); };
+    options.initialState = NULL;
+    positiveBuffer.clear();
+    negativeBuffer.clear();
+    paretoenumerator::enumerateParetoFront(fun,limits,sink,options);
+    while (true) {
+        for (size_t i=0;i<state.positivePoints.size();i++) {
+            const std::vector<int> positivePoint = state.positivePoints.point(i);
+            for (auto &a : sunkPoints) {
+                if (vectorOfIntIsLeq(a,positivePoint)) throw "Error: The state of a run with a sink keeps a point that is not below the Pareto points.";
+            }
+        }
+        if (!state.paretoFront.empty()) throw "Error: The state of a run with a sink contains Pareto points.";
+        if (state.coParetoElements.empty()) break;
+        paretoenumerator::EnumerationState previousState = state;
+        options.initialState = &previousState;
+        paretoenumerator::enumerateParetoFront(fun,limits,sink,options);
+    }
+    if ((sunkPoints.size()!=paretoPoints.size()) || (std::set<std::vector<int> >(sunkPoints.begin(),sunkPoints.end())!=std::set<std::vector<int> >(paretoPoints.begin(),paretoPoints.end()))) throw "Error: Wrong Pareto points passed to a sink";
+
+    // The stop token is checked before every call to the feasibility function
+    std::atomic<bool> stopToken(false);
+    nofCalls = 0;
+    size_t nofCallsBeforeStop = randomSeed % 20 + 1;
+    std::function<bool(const std::vector<int> &)> stoppingFun = [&paretoPoints,&nofCalls,nofCallsBeforeStop,&stopToken] (const std::vector<int> &point) {
+        if (++nofCalls==nofCallsBeforeStop) stopToken = true;
+        for (auto &a : paretoPoints) {
+            if (vectorOfIntIsLeq(a,point)) return true;
+        }
+        return false;
+    };
+    paretoenumerator::EnumerationOptions stopOptions;
+    stopOptions.stopToken = &stopToken;
+    stopOptions.finalState = &state;
+    front = paretoenumerator::enumerateParetoFront(stoppingFun,limits,stopOptions);
+    if (nofCalls>nofCallsBeforeStop) throw "Error: The enumeration did not stop when the stop token was set.";
+    if ((nofCalls<nofCallsBeforeStop) && !state.coParetoElements.empty()) throw "Error: The enumeration stopped without a reason.";
+    for (auto &a : front) {
+        if (std::find(paretoPoints.begin(),paretoPoints.end(),a)==paretoPoints.end()) throw "Error: A stopped run returned a wrong Pareto point.";
+    }
+}
+
+//=================================================================================
+// Seventh test: Distribute an enumeration over several workers
+//              -> Keep several work units open at once and finish them in a
+//                 random order, with small budgets, through the wire format.
+//                 Some workers fail. Continue from a snapshot of the
+//                 coordinator with an ordinary run.
+//=================================================================================
+void doDistributedTest(unsigned int randomSeed) {
+    std::vector<std::pair<int,int> > limits;
+    std::list<std::vector<int> > paretoPoints;
+    makeRandomProblem(randomSeed,limits,paretoPoints);
+    const std::set<std::vector<int> > paretoSet(paretoPoints.begin(),paretoPoints.end());
+    std::mt19937 rng(randomSeed);
+    std::function<bool(const std::vector<int> &)> fun = [&paretoPoints] (const std::vector<int> &point) {
+        for (auto &a : paretoPoints) {
+            if (vectorOfIntIsLeq(a,point)) return true;
+        }
+        return false;
+    };
+
+    paretoenumerator::EnumerationOptions options;
+    options.selection = static_cast<paretoenumerator::CoParetoSelection>(randomSeed % 3);
+    paretoenumerator::EnumerationCoordinator coordinator(limits,options);
+    std::vector<std::pair<size_t,std::string> > openWorkUnits;
+    bool continuedFromSnapshot = false;
+    while (!coordinator.isFinished()) {
+        size_t workUnitId;
+        paretoenumerator::EnumerationState workUnit;
+        if ((openWorkUnits.size()<rng() % 4 + 1) && coordinator.getWorkUnit(rng() % 5 + 1,workUnitId,workUnit)) {
+            std::string encoded = paretoenumerator::encodeEnumerationState(workUnit);
+            paretoenumerator::EnumerationState decoded;
+            paretoenumerator::decodeEnumerationState(encoded,decoded);
+            if (paretoenumerator::encodeEnumerationState(decoded)!=encoded) throw "Error: Decoding an encoded enumeration state changed it.";
+            openWorkUnits.push_back(std::make_pair(workUnitId,encoded));
+            continue;
+        }
+        if (openWorkUnits.empty()) throw "Error: The coordinator has neither work units nor open ones, but is not finished.";
+        if (openWorkUnits.size()!=coordinator.nofOpenWorkUnits()) throw "Error: Wrong number of open work units.";
+
+        size_t index = rng() % openWorkUnits.size();
+        std::pair<size_t,std::string> openWorkUnit = openWorkUnits[index];
+        openWorkUnits.erase(openWorkUnits.begin()+index);
+        if (rng() % 8==0) {
+            coordinator.returnWorkUnit(openWorkUnit.first);
+            continue;
+        }
+        paretoenumerator::decodeEnumerationState(openWorkUnit.second,workUnit);
+        paretoenumerator::EnumerationOptions workerOptions;
+        workerOptions.oracleCallBudget = rng() % 20 + 1;
+        paretoenumerator::EnumerationState result;
+        paretoenumerator::enumerateWorkUnit(fun,workUnit,result,workerOptions);
+        paretoenumerator::EnumerationState decodedResult;
+        paretoenumerator::decodeEnumerationState(paretoenumerator::encodeEnumerationState(result),decodedResult);
+        coordinator.addResult(openWorkUnit.first,decodedResult);
+
+        // A snapshot with open work units is a complete state
+        if (!continuedFromSnapshot && !openWorkUnits.empty()) {
+            continuedFromSnapshot = true;
+            paretoenumerator::EnumerationState snapshot;
+            coordinator.getState(snapshot);
+            paretoenumerator::EnumerationOptions snapshotOptions;
+            snapshotOptions.initialState = &snapshot;
+            std::list<std::vector<int> > front = paretoenumerator::enumerateParetoFront(fun,limits,snapshotOptions);
+            if ((front.size()!=paretoSet.size()) || (std::set<std::vector<int> >(front.begin(),front.end())!=paretoSet)) throw "Error: Wrong Pareto front after continuing from a snapshot of a coordinator.";
+        }
+    }
+    std::list<std::vector<int> > front = coordinator.getParetoFront().toList();
+    if ((front.size()!=paretoSet.size()) || (std::set<std::vector<int> >(front.begin(),front.end())!=paretoSet)) throw "Error: Wrong Pareto front after a distributed enumeration.";
+
+    paretoenumerator::EnumerationState state;
+    coordinator.getState(state);
+    std::string encoded = paretoenumerator::encodeEnumerationState(state);
+    try {
+        paretoenumerator::decodeEnumerationState(encoded.substr(0,encoded.size()-1),state);
+        throw "Error: A truncated encoded enumeration state was accepted.";
+    } catch (const char *error) {
+        if (std::string(error)!="Error: The encoded enumeration state is truncated.") throw;
+    }
+}
+
+//=================================================================================
+// Eighth test: Start runs from what is known from outside
+//              -> Seeds that are Pareto points, seeds that are moved up or
+//                 down, and known infeasible points, which are verified.
+//                 Then trust all Pareto points, and trust the Pareto points
+//                 and co-Pareto elements of a stopped run.
+//=================================================================================
+void doWarmStartTest(unsigned int randomSeed) {
+    std::vector<std::pair<int,int> > limits;
+    std::list<std::vector<int> > paretoPoints;
+    makeRandomProblem(randomSeed,limits,paretoPoints);
+    const std::set<std::vector<int> > paretoSet(paretoPoints.begin(),paretoPoints.end());
+    const size_t nofDimensions = limits.size();
+    std::mt19937 rng(randomSeed);
+
+    std::list<std::vector<int> > positiveBuffer;
+    std::list<std::vector<int> > negativeBuffer;
+    std::function<bool(const std::vector<int> &)> fun = [&paretoPoints,&positiveBuffer,&negativeBuffer] (const std::vector<int> &point) {
+        return randomTestFeasibilityFunction(point,paretoPoints,positiveBuffer,negativeBuffer);
+    };
+    auto isFeasible = [&paretoPoints] (const std::vector<int> &point) {
+        for (auto &a : paretoPoints) {
+            if (vectorOfIntIsLeq(a,point)) return true;
+        }
+        return false;
+    };
+
+    paretoenumerator::WarmStart warmStart;
+    warmStart.paretoPoints = paretoenumerator::PointSet(nofDimensions);
+    warmStart.negativePoints = paretoenumerator::PointSet(nofDimensions);
+    for (auto &a : paretoPoints) {
+        std::vector<int> seed = a;
+        const size_t d = rng() % nofDimensions;
+        switch (rng() % 4) {
+        case 0: continue;
+        case 1: break;
+        case 2: seed[d] = std::min(limits[d].second,seed[d]+1); break;
+        default: seed[d] = std::max(limits[d].first,seed[d]-1);
+        }
+        warmStart.paretoPoints.push_back(seed);
+    }
+    for (unsigned int i=0;i<10;i++) {
+        std::vector<int> point(nofDimensions);
+        for (size_t d=0;d<nofDimensions;d++) point[d] = limits[d].first + rng() % (limits[d].second-limits[d].first+1);
+        if (!isFeasible(point)) warmStart.negativePoints.push_back(point);
+    }
+
+    // Points that are given many times are only used once. Otherwise, they would not fit into a leaf of a point index.
+    std::vector<int> maximalPoint(nofDimensions);
+    for (size_t d=0;d<nofDimensions;d++) maximalPoint[d] = limits[d].second;
+    warmStart.coParetoElements = paretoenumerator::PointSet(nofDimensions);
+    for (unsigned int i=0;i<70;i++) warmStart.coParetoElements.push_back(maximalPoint);
+    if (!warmStart.negativePoints.empty()) {
+        const std::vector<int> negativePoint = warmStart.negativePoints.point(0);
+        for (unsigned int i=0;i<70;i++) warmStart.negativePoints.push_back(negativePoint);
+    }
+    paretoenumerator::EnumerationOptions options;
+    paretoenumerator::EnumerationStats stats;
+    options.warmStart = &warmStart;
+    options.stats = &stats;
+    options.maxBatchSize = randomSeed % 5 + 1;
+    std::list<std::vector<int> > front = paretoenumerator::enumerateParetoFront(fun,limits,options);
+    if ((front.size()!=paretoSet.size()) || (std::set<std::vector<int> >(front.begin(),front.end())!=paretoSet)) throw "Error: Wrong Pareto front after a warm start.";
+
+    // Verifying Pareto points takes one search call per dimension
+    warmStart.paretoPoints = paretoenumerator::PointSet(nofDimensions,paretoPoints);
+    warmStart.negativePoints.clear();
+    positiveBuffer.clear();
+    negativeBuffer.clear();
+    front = paretoenumerator::enumerateParetoFront(fun,limits,options);
+    if ((front.size()!=paretoSet.size()) || (std::set<std::vector<int> >(front.begin(),front.end())!=paretoSet)) throw "Error: Wrong Pareto front after a warm start with all Pareto points.";
+    if (stats.nofSearchOracleCalls>paretoPoints.size()*nofDimensions) throw "Error: Verifying the seeds of a warm start took too many calls.";
+
+    // Seeds that are given twice are evaluated once, and trusted ones are only added to the front once
+    const size_t nofOracleCallsWithoutDuplicates = stats.nofOracleCalls;
+    for (auto &a : paretoPoints) warmStart.paretoPoints.push_back(a);
+    positiveBuffer.clear();
+    negativeBuffer.clear();
+    front = paretoenumerator::enumerateParetoFront(fun,limits,options);
+    if ((front.size()!=paretoSet.size()) || (std::set<std::vector<int> >(front.begin(),front.end())!=paretoSet)) throw "Error: Wrong Pareto front after a warm start with duplicate seeds.";
+    if (stats.nofOracleCalls!=nofOracleCallsWithoutDuplicates) throw "Error: A warm start evaluated a seed several times.";
+
+    // Trusted Pareto points are not searched for
+    warmStart.trustParetoPoints = true;
+    positiveBuffer.clear();
+    negativeBuffer.clear();
+    front = paretoenumerator::enumerateParetoFront(fun,limits,options);
+    if ((front.size()!=paretoSet.size()) || (std::set<std::vector<int> >(front.begin(),front.end())!=paretoSet)) throw "Error: Wrong Pareto front after a warm start with trusted Pareto points.";
+    if ((stats.nofSearchOracleCalls!=0) || (stats.nofParetoPointsFound!=0)) throw "Error: A warm start searched for trusted Pareto points.";
+
+    // The Pareto points and co-Pareto elements of a stopped run
+    paretoenumerator::EnumerationOptions stoppedOptions;
+    paretoenumerator::EnumerationState state;
+    stoppedOptions.oracleCallBudget = randomSeed % 30 + 1;
+    stoppedOptions.finalState = &state;
+    positiveBuffer.clear();
+    negativeBuffer.clear();
+    paretoenumerator::enumerateParetoFront(fun,limits,stoppedOptions);
+    warmStart.paretoPoints = state.paretoFront;
+    warmStart.coParetoElements = state.coParetoElements;
+    if (warmStart.coParetoElements.empty()) return;
+    positiveBuffer.clear();
+    negativeBuffer.clear();
+    front = paretoenumerator::enumerateParetoFront(fun,limits,options);
+    if ((front.size()!=paretoSet.size()) || (std::set<std::vector<int> >(front.begin(),front.end())!=paretoSet)) throw "Error: Wrong Pareto front after a warm start with co-Pareto elements.";
+}
+
+//=================================================================================
+// Ninth test: Share the results of the feasibility function between runs
+//             through an oracle cache
+//=================================================================================
+void doOracleCacheTest(unsigned int randomSeed) {
+    std::vector<std::pair<int,int> > limits;
+    std::list<std::vector<int> > paretoPoints;
+    makeRandomProblem(randomSeed,limits,paretoPoints);
+    const std::set<std::vector<int> > paretoSet(paretoPoints.begin(),paretoPoints.end());
+    const size_t nofDimensions = limits.size();
+
+    std::list<std::vector<int> > positiveBuffer;
+    std::list<std::vector<int> > negativeBuffer;
+    std::map<std::vector<int>,bool> results;
+    std::function<bool(const std::vector<int> &)> fun = [&paretoPoints,&positiveBuffer,&negativeBuffer,&results] (const std::vector<int> &point) {
+        bool result = randomTestFeasibilityFunction(point,paretoPoints,positiveBuffer,negativeBuffer);
+        results[point] = result;
+        return result;
+    };
+
+    // With enough room for everything, the second run does not call the feasibility function at all
+    paretoenumerator::OracleCache largeCache(nofDimensions,100000);
+    paretoenumerator::EnumerationOptions options;
+    paretoenumerator::EnumerationStats stats;
+    options.oracleCache = &largeCache;
+    options.stats = &stats;
+    options.maxBatchSize = randomSeed % 5 + 1;
+    options.searchArity = randomSeed % 3 + 1;
+    std::list<std::vector<int> > front = paretoenumerator::enumerateParetoFront(fun,limits,options);
+    if (std::set<std::vector<int> >(front.begin(),front.end())!=paretoSet) throw "Error: Wrong Pareto front with an oracle cache.";
+    if ((stats.nofOracleCacheHits!=0) || (largeCache.size()!=stats.nofOracleCalls)) throw "Error: Wrong statistics of a run with an empty oracle cache.";
+    const size_t nofCallsWithoutCache = stats.nofOracleCalls;
+    std::function<bool(const std::vector<int> &)> failingFun = [] (const std::vector<int> &) -> bool {
+        throw "Error: Called the feasibility function although all results are in the oracle cache.";
+    };
+    front = paretoenumerator::enumerateParetoFront(failingFun,limits,options);
+    if (std::set<std::vector<int> >(front.begin(),front.end())!=paretoSet) throw "Error: Wrong Pareto front with a full oracle cache.";
+    if ((stats.nofOracleCalls!=0) || (stats.nofOracleCacheHits!=nofCallsWithoutCache)) throw "Error: Wrong statistics of a run with a full oracle cache.";
+
+    // Small caches evict entries or stop taking new ones, but they never return wrong results
+    const paretoenumerator::CacheEviction eviction = ((randomSeed % 2)==0)?paretoenumerator::EVICT_CLOCK:paretoenumerator::EVICT_NOTHING;
+    paretoenumerator::OracleCache smallCache(nofDimensions,randomSeed % 20 + 1,eviction);
+    options.oracleCache = &smallCache;
+    for (unsigned int run=0;run<2;run++) {
+        positiveBuffer.clear();
+        negativeBuffer.clear();
+        front = paretoenumerator::enumerateParetoFront(fun,limits,options);
+        if (std::set<std::vector<int> >(front.begin(),front.end())!=paretoSet) throw "Error: Wrong Pareto front with a small oracle cache.";
+        if (stats.nofOracleCalls+stats.nofOracleCacheHits!=nofCallsWithoutCache) throw "Error: Wrong statistics of a run with a small oracle cache.";
+        if (smallCache.size()>smallCache.capacity()) throw "Error: An oracle cache holds more entries than its capacity.";
+        if ((eviction==paretoenumerator::EVICT_NOTHING) && (smallCache.nofEvictions()!=0)) throw "Error: An oracle cache evicted entries although it should not.";
+    }
+    size_t nofCachedResults = 0;
+    for (auto &a : results) {
+        bool result;
+        if (smallCache.lookup(a.first.data(),result)) {
+            if (result!=a.second) throw "Error: An oracle cache returned a wrong result.";
+            nofCachedResults++;
+        }
+    }
+    if (nofCachedResults!=smallCache.size()) throw "Error: An oracle cache holds results for points that were never evaluated.";
+
+    bool result;
+    smallCache.clear();
+    if ((smallCache.size()!=0) || (!results.empty() && smallCache.lookup(results.begin()->first.data(),result))) throw "Error: Clearing an oracle cache did not remove its entries.";
+}
+
+//=================================================================================
+// Tenth test: Enumerate with an asynchronous feasibility function whose calls
+//             finish in random order
+//=================================================================================
+void doAsyncTest(unsigned int randomSeed) {
+    std::vector<std::pair<int,int> > limits;
+    std::list<std::vector<int> > paretoPoints;
+    makeRandomProblem(randomSeed,limits,paretoPoints);
+    const std::set<std::vector<int> > paretoSet(paretoPoints.begin(),paretoPoints.end());
+
+    std::list<std::vector<int> > positiveBuffer;
+    std::list<std::vector<int> > negativeBuffer;
+    std::mutex mutex;
+    std::atomic<size_t> nofPendingCalls(0);
+    std::atomic<size_t> maxNofPendingCalls(0);
+    paretoenumerator::EnumerationOptions options;
+    options.maxBatchSize = randomSeed % 8 + 1;
+    options.searchArity = randomSeed % 3 + 1;
+    const bool checkRedundantCalls = options.searchArity==1;
+    unsigned int nofCalls = 0;
+    auto asyncFun = [&] (const std::vector<int> &point) {
+        size_t nofPending = ++nofPendingCalls;
+        size_t maxNofPending = maxNofPendingCalls.load();
+        while ((nofPending>maxNofPending) && !maxNofPendingCalls.compare_exchange_weak(maxNofPending,nofPending)) {}
+        const std::chrono::microseconds delay((randomSeed+nofCalls++) % 7 * 20);
+        return std::async(std::launch::async,[&,delay] () {
+            std::this_thread::sleep_for(delay);
+            bool result;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                result = randomTestFeasibilityFunction(point,paretoPoints,positiveBuffer,negativeBuffer,checkRedundantCalls);
+            }
+            nofPendingCalls--;
+            return result;
+        });
+    };
+    paretoenumerator::EnumerationStats stats;
+    if ((randomSeed % 2)==0) options.stats = &stats;
+    std::list<std::vector<int> > front = paretoenumerator::enumerateParetoFront(asyncFun,limits,options);
+    if (std::set<std::vector<int> >(front.begin(),front.end())!=paretoSet) throw "Error: Wrong Pareto front with an asynchronous feasibility function.";
+    if ((maxNofPendingCalls>options.maxBatchSize) || (nofPendingCalls!=0)) throw "Error: Wrong number of pending calls to an asynchronous feasibility function.";
+    if ((options.stats!=NULL) && (stats.nofOracleCalls!=nofCalls)) throw "Error: Wrong number of oracle calls in the statistics of an asynchronous feasibility function.";
+
+    // Errors in the asynchronous calls reach the caller
+    const unsigned int failingCall = randomSeed % 5;
+    nofCalls = 0;
+    std::function<std::future<bool>(const std::vector<int> &)> failingFun = [&nofCalls,failingCall] (const std::vector<int> &) {
+        std::promise<bool> promise;
+        if (nofCalls++==failingCall) {
+            promise.set_exception(std::make_exception_ptr("Error: The remote feasibility check failed."));
+        } else {
+            promise.set_value(true);
+        }
+        return promise.get_future();
+    };
+    try {
+        paretoenumerator::enumerateParetoFront(failingFun,limits,options);
+    } catch (const char *error) {
+        if (std::string(error)!="Error: The remote feasibility check failed.") throw;
+        return;
+    }
+    if (nofCalls>failingCall) throw "Error: An error in an asynchronous feasibility function was lost.";
+}
+
+//=================================================================================
+// Eleventh test: Enumerate with a memory limit, so that co-Pareto elements and
+//                infeasible points are spilled to disk
+//=================================================================================
+void doMemoryLimitTest(unsigned int randomSeed) {
+    std::vector<std::pair<int,int> > limits;
+    std::list<std::vector<int> > paretoPoints;
+    makeRandomProblem(randomSeed,limits,paretoPoints);
+    const std::set<std::vector<int> > paretoSet(paretoPoints.begin(),paretoPoints.end());
+
+    // Spilled infeasible points are not checked for every call, so redundant calls are allowed
+    std::list<std::vector<int> > positiveBuffer;
+    std::list<std::vector<int> > negativeBuffer;
+    std::function<bool(const std::vector<int> &)> fun = [&paretoPoints,&positiveBuffer,&negativeBuffer] (const std::vector<int> &point) {
+        return randomTestFeasibilityFunction(point,paretoPoints,positiveBuffer,negativeBuffer,false);
+    };
+    paretoenumerator::EnumerationOptions options;
+    paretoenumerator::EnumerationStats stats;
+    options.stats = &stats;
+    options.memoryLimit = ((randomSeed % 2)==0)?1:20000;
+    options.spillDirectory = ((randomSeed % 3)==0)?".":"";
+    options.maxBatchSize = randomSeed % 4 + 1;
+    options.selection = static_cast<paretoenumerator::CoParetoSelection>(randomSeed % 4);
+    options.selectionPriority = [](const std::vector<int> &point) { return static_cast<double>(point[0]); };
+    std::list<std::vector<int> > front = paretoenumerator::enumerateParetoFront(fun,limits,options);
+    if (std::set<std::vector<int> >(front.begin(),front.end())!=paretoSet) throw "Error: Wrong Pareto front with a memory limit.";
+    if ((options.memoryLimit==1) && (stats.maxNofCoParetoElements>1) && (stats.nofSpilledCoParetoElements==0)) throw "Error: Exceeded the memory limit without spilling co-Pareto elements.";
+
+    // The state of a stopped run includes the spilled points
+    paretoenumerator::EnumerationState state;
+    options.oracleCallBudget = randomSeed % 40 + 1;
+    options.finalState = &state;
+    positiveBuffer.clear();
+    negativeBuffer.clear();
+    paretoenumerator::enumerateParetoFront(fun,limits,options);
+    paretoenumerator::EnumerationOptions resumeOptions;
+    resumeOptions.initialState = &state;
+    front = paretoenumerator::enumerateParetoFront(fun,limits,resumeOptions);
+    if (std::set<std::vector<int> >(front.begin(),front.end())!=paretoSet) throw "Error: Wrong Pareto front after continuing a run with spilled points.";
+}
+
+//=================================================================================
+// Twelfth test: Approximate the Pareto front with tolerances, and refine the
+//               approximation into the exact Pareto front
+//=================================================================================
+void doApproximationTest(unsigned int randomSeed) {
+    std::vector<std::pair<int,int> > limits;
+    std::list<std::vector<int> > paretoPoints;
+    makeRandomProblem(randomSeed,limits,paretoPoints);
+    const std::set<std::vector<int> > paretoSet(paretoPoints.begin(),paretoPoints.end());
+    std::mt19937 rng(randomSeed);
+
+    // The refined run must not repeat any call of the approximation
+    std::list<std::vector<int> > positiveBuffer;
+    std::list<std::vector<int> > negativeBuffer;
+    std::function<bool(const std::vector<int> &)> fun = [&paretoPoints,&positiveBuffer,&negativeBuffer] (const std::vector<int> &point) {
+        return randomTestFeasibilityFunction(point,paretoPoints,positiveBuffer,negativeBuffer);
+    };
+    paretoenumerator::EnumerationOptions options;
+    for (size_t i=0;i<limits.size();i++) options.approximationTolerance.push_back(rng() % 12);
+    options.valueSearch = static_cast<paretoenumerator::ValueSearch>(rng() % 4);
+    options.dimensionOrder = static_cast<paretoenumerator::DimensionOrder>(rng() % 4);
+    const bool stopEarly = (rng() % 3)==0;
+    if (stopEarly) options.oracleCallBudget = rng() % 40 + 1;
+    paretoenumerator::EnumerationState approximateState;
+    options.finalState = &approximateState;
+    std::list<std::vector<int> > approximation = paretoenumerator::enumerateParetoFront(fun,limits,options);
+    const std::list<std::vector<int> > positiveBufferOfApproximation = positiveBuffer;
+    const std::list<std::vector<int> > negativeBufferOfApproximation = negativeBuffer;
+
+    // Every point of the approximation is feasible, and every Pareto point is at most the tolerances below one of them
+    for (auto const &point : approximation) {
+        if (std::none_of(paretoPoints.begin(),paretoPoints.end(),[&point](const std::vector<int> &a) { return vectorOfIntIsLeq(a,point); })) throw "Error: The approximation of the Pareto front contains an infeasible point.";
+    }
+    if (!stopEarly) {
+        if (!approximateState.coParetoElements.empty()) throw "Error: An approximation that was not stopped has co-Pareto elements left.";
+        for (auto const &paretoPoint : paretoPoints) {
+            std::vector<int> upperBound = paretoPoint;
+            for (size_t i=0;i<limits.size();i++) upperBound[i] += options.approximationTolerance[i];
+            if (std::none_of(approximation.begin(),approximation.end(),[&upperBound](const std::vector<int> &a) { return vectorOfIntIsLeq(a,upperBound); })) throw "Error: A Pareto point is not approximated within the tolerances.";
+        }
+    }
+
+    // Refine the approximation, possibly after encoding its state for another machine
+    paretoenumerator::EnumerationState exactState;
+    paretoenumerator::refineEnumerationState(approximateState,exactState);
+    if ((rng() % 2)==0) paretoenumerator::decodeEnumerationState(paretoenumerator::encodeEnumerationState(exactState),exactState);
+    paretoenumerator::EnumerationOptions refineOptions;
+    refineOptions.initialState = &exactState;
+    std::list<std::vector<int> > front = paretoenumerator::enumerateParetoFront(fun,limits,refineOptions);
+    if ((front.size()!=paretoSet.size()) || (std::set<std::vector<int> >(front.begin(),front.end())!=paretoSet)) throw "Error: Wrong Pareto front after refining an approximation.";
+
+    // The state records the tolerances, so an exact run that continues from a state file of the approximation refines
+    // it by itself rather than returning the approximation as the Pareto front, again without repeating any call
+    const char *stateFile = "pareto_enumerator_test_approximation.bin";
+    paretoenumerator::saveEnumerationState(stateFile,approximateState);
+    paretoenumerator::EnumerationState loadedState;
+    if (!paretoenumerator::loadEnumerationState(stateFile,loadedState) || (loadedState.approximationTolerance!=options.approximationTolerance)) throw "Error: The state file of an approximation lost its tolerances.";
+    paretoenumerator::decodeEnumerationState(paretoenumerator::encodeEnumerationState(approximateState),loadedState);
+    if (loadedState.approximationTolerance!=options.approximationTolerance) throw "Error: The encoded state of an approximation lost its tolerances.";
+    if (!exactState.approximationTolerance.empty()) throw "Error: A refined state has approximation tolerances.";
+    paretoenumerator::EnumerationOptions exactOptions;
+    exactOptions.stateFile = stateFile;
+    positiveBuffer = positiveBufferOfApproximation;
+    negativeBuffer = negativeBufferOfApproximation;
+    front = paretoenumerator::enumerateParetoFront(fun,limits,exactOptions);
+    std::remove(stateFile);
+    if ((front.size()!=paretoSet.size()) || (std::set<std::vector<int> >(front.begin(),front.end())!=paretoSet)) throw "Error: Wrong Pareto front of an exact run that continues from an approximation.";
+}
+
+//=================================================================================
+// Thirteenth test: Keep track of bounds on the hypervolume of the Pareto front
+//                  -> Compare them against the hypervolumes counted point by
+//                     point, also with the largest gaps first, and stop runs
+//                     once they have found a fraction of the hypervolume
+//=================================================================================
+void doHypervolumeTest(unsigned int randomSeed) {
+    std::mt19937 rng(randomSeed);
+    std::vector<std::pair<int,int> > limits;
+    std::list<std::vector<int> > paretoPoints;
+    const unsigned int nofDimensions = rng() % 3 + 2;
+    for (unsigned int i=0;i<nofDimensions;i++) {
+        int min = rng() % 10 - 5;
+        limits.push_back(std::pair<int,int>(min,min + rng() % 12 + 1));
+    }
+    const unsigned int nofPoints = rng() % 10 + 1;
+    for (unsigned int i=0;i<nofPoints;i++) {
+        std::vector<int> newPoint;
+        for (unsigned int j=0;j<nofDimensions;j++) newPoint.push_back(rng() % (limits[j].second - limits[j].first + 1) + limits[j].first);
+        paretoPoints.push_back(newPoint);
+    }
+    paretoPoints = cleanParetoFront(paretoPoints);
+    const std::set<std::vector<int> > paretoSet(paretoPoints.begin(),paretoPoints.end());
+
+    // The number of points within the limits that are greater than or equal to one of "points"
+    auto countDominatedPoints = [&limits](const std::list<std::vector<int> > &points) {
+        double volume = 0.0;
+        std::vector<int> point;
+        for (auto const &limit : limits) point.push_back(limit.first);
+        while (true) {
+            if (std::any_of(points.begin(),points.end(),[&point](const std::vector<int> &a) { return vectorOfIntIsLeq(a,point); })) volume += 1.0;
+            size_t i = 0;
+            for (;(i<limits.size()) && (point[i]==limits[i].second);i++) point[i] = limits[i].first;
+            if (i==limits.size()) return volume;
+            point[i]++;
+        }
+    };
+    const double paretoVolume = countDominatedPoints(paretoPoints);
+    double totalVolume = 1.0;
+    for (auto const &limit : limits) totalVolume *= limit.second - limit.first + 1;
+
+    std::list<std::vector<int> > positiveBuffer;
+    std::list<std::vector<int> > negativeBuffer;
+    std::function<bool(const std::vector<int> &)> fun = [&paretoPoints,&positiveBuffer,&negativeBuffer] (const std::vector<int> &point) {
+        return randomTestFeasibilityFunction(point,paretoPoints,positiveBuffer,negativeBuffer);
+    };
+    paretoenumerator::EnumerationOptions options;
+    options.maxBatchSize = rng() % 4 + 1;
+    options.selection = ((rng() % 2)==0)?paretoenumerator::SELECT_LARGEST_GAP_FIRST:static_cast<paretoenumerator::CoParetoSelection>(rng() % 4);
+    options.selectionPriority = [](const std::vector<int> &point) { return static_cast<double>(point[0]); };
+    paretoenumerator::HypervolumeBound lastBound;
+    lastBound.dominatedVolume = 0.0;
+    lastBound.undecidedVolume = std::numeric_limits<double>::infinity();
+    options.hypervolumeProgress = [&totalVolume,&paretoVolume,&lastBound](const paretoenumerator::HypervolumeBound &bound) {
+        if (bound.totalVolume!=totalVolume) throw "Error: Wrong total volume in the bounds on the hypervolume.";
+        if ((bound.dominatedVolume>paretoVolume) || (bound.dominatedVolume+bound.undecidedVolume<paretoVolume)) throw "Error: The hypervolume of the Pareto front is outside of its bounds.";
+        if ((bound.dominatedVolume<lastBound.dominatedVolume) || (bound.undecidedVolume>lastBound.undecidedVolume)) throw "Error: The bounds on the hypervolume got worse.";
+        lastBound = bound;
+    };
+    std::list<std::vector<int> > front = paretoenumerator::enumerateParetoFront(fun,limits,options);
+    if (std::set<std::vector<int> >(front.begin(),front.end())!=paretoSet) throw "Error: Wrong Pareto front while keeping track of the hypervolume.";
+    if ((lastBound.dominatedVolume!=paretoVolume) || (lastBound.undecidedVolume!=0.0) || (lastBound.quality()!=1.0)) throw "Error: Wrong bounds on the hypervolume at the end of a run.";
+
+    // Stop once the Pareto points found dominate a fraction of the hypervolume of the Pareto front
+    options.hypervolumeTarget = (rng() % 9 + 1) / 10.0;
+    positiveBuffer.clear();
+    negativeBuffer.clear();
+    lastBound.dominatedVolume = 0.0;
+    lastBound.undecidedVolume = std::numeric_limits<double>::infinity();
+    front = paretoenumerator::enumerateParetoFront(fun,limits,options);
+    for (auto const &point : front) {
+        if (paretoSet.count(point)==0) throw "Error: A run that stopped at a hypervolume target found a point that is not a Pareto point.";
+    }
+    const double frontVolume = countDominatedPoints(front);
+    if ((lastBound.dominatedVolume!=frontVolume) || (lastBound.quality()<options.hypervolumeTarget) || (frontVolume<options.hypervolumeTarget*paretoVolume)) throw "Error: A run stopped before reaching its hypervolume target.";
+}
+
+//=================================================================================
+// Fourteenth test: Compare the block comparison kernels against plain
+//                  comparisons
+//                  -> Every kernel that is compiled in and that the CPU supports
+//                     is tested, not just the one that the point indices use,
+//                     for unpacked and for packed coordinates, and for any
+//                     number of dimensions as well as for the fixed number
+//                     of dimensions of the enumerators, if there is one
+//=================================================================================
+std::vector<paretoenumerator::detail::BlockKernels> getTestedBlockKernels(size_t nofDimensions) {
+    using namespace paretoenumerator::detail;
+    std::vector<BlockKernels> kernels = getSupportedBlockKernels<0>();
+    std::vector<BlockKernels> fixedKernels;
+    switch (nofDimensions) {
+    case 3: fixedKernels = getSupportedBlockKernels<3>(); break;
+    case 4: fixedKernels = getSupportedBlockKernels<4>(); break;
+    case 5: fixedKernels = getSupportedBlockKernels<5>(); break;
+    case 6: fixedKernels = getSupportedBlockKernels<6>(); break;
+    }
+    kernels.insert(kernels.end(),fixedKernels.begin(),fixedKernels.end());
+    return kernels;
+}
+
+std::vector<paretoenumerator::detail::PackedBlockKernels> getTestedPackedBlockKernels(size_t nofDimensions, unsigned int bitsPerCoordinate) {
+    using namespace paretoenumerator::detail;
+    std::vector<PackedBlockKernels> kernels = getSupportedPackedBlockKernels<0>(bitsPerCoordinate);
+    std::vector<PackedBlockKernels> fixedKernels;
+    switch (nofDimensions) {
+    case 3: fixedKernels = getSupportedPackedBlockKernels<3>(bitsPerCoordinate); break;
+    case 4: fixedKernels = getSupportedPackedBlockKernels<4>(bitsPerCoordinate); break;
+    case 5: fixedKernels = getSupportedPackedBlockKernels<5>(bitsPerCoordinate); break;
+    case 6: fixedKernels = getSupportedPackedBlockKernels<6>(bitsPerCoordinate); break;
+    }
+    kernels.insert(kernels.end(),fixedKernels.begin(),fixedKernels.end());
+    return kernels;
+}
+
+void doBlockKernelTest(unsigned int randomSeed) {
+    std::mt19937 rng(randomSeed);
+    const size_t blockCapacity = paretoenumerator::detail::blockCapacity;
+    const size_t nofDimensions = rng() % 10 + 1;
+    const uint64_t mask = ((rng() % 4)==0)?~uint64_t(0):((uint64_t(rng()) << 32) | rng());
+    std::vector<int> point(nofDimensions);
+    std::vector<int> values(blockCapacity*nofDimensions);
+
+    // Draws values from a small range around the coordinates of the point most of the time, so that many of them are
+    // equal to the coordinates or decide the comparison in a single dimension
+    auto drawValues = [&rng,&point,&values,nofDimensions,blockCapacity] (long long minValue, long long maxValue) {
+        auto draw = [&rng] (long long min, long long max) { return static_cast<int>(min+(long long)(((uint64_t(rng()) << 32) | rng()) % uint64_t(max-min+1))); };
+        for (auto &value : point) value = draw(minValue,maxValue);
+        const bool nearPoint = (rng() % 4)!=0;
+        for (size_t d=0;d<nofDimensions;d++) {
+            for (size_t i=0;i<blockCapacity;i++) {
+                values[d*blockCapacity+i] = nearPoint?draw(std::max(minValue,(long long)point[d]-1),std::min(maxValue,(long long)point[d]+1)):draw(minValue,maxValue);
+            }
+        }
+    };
+    auto expectedResult = [&point,&values,mask,nofDimensions,blockCapacity] (bool geq) {
+        uint64_t result = 0;
+        for (size_t i=0;i<blockCapacity;i++) {
+            bool matches = ((mask >> i) & 1)!=0;
+            for (size_t d=0;d<nofDimensions;d++) matches &= geq?(values[d*blockCapacity+i]>=point[d]):(values[d*blockCapacity+i]<=point[d]);
+            if (matches) result |= uint64_t(1) << i;
+        }
+        return result;
+    };
+
+    drawValues(std::numeric_limits<int>::min(),std::numeric_limits<int>::max());
+    for (bool geq : {true,false}) {
+        for (auto const &kernels : getTestedBlockKernels(nofDimensions)) {
+            if ((geq?kernels.geq:kernels.leq)(values.data(),point.data(),nofDimensions,mask)!=expectedResult(geq)) throw "Error: A block comparison kernel returned a wrong result.";
+        }
+    }
+
+    for (unsigned int bitsPerCoordinate : {1,8,16}) {
+        drawValues(0,(1LL << bitsPerCoordinate)-1);
+        std::vector<uint64_t> packedValues(bitsPerCoordinate*nofDimensions);
+        for (size_t d=0;d<nofDimensions;d++) {
+            for (size_t i=0;i<blockCapacity;i++) paretoenumerator::detail::setPackedValue(&(packedValues[d*bitsPerCoordinate]),i,bitsPerCoordinate,values[d*blockCapacity+i]);
+        }
+        for (bool geq : {true,false}) {
+            for (auto const &kernels : getTestedPackedBlockKernels(nofDimensions,bitsPerCoordinate)) {
+                if ((geq?kernels.geq:kernels.leq)(packedValues.data(),point.data(),nofDimensions,mask)!=expectedResult(geq)) throw "Error: A block comparison kernel for packed coordinates returned a wrong result.";
+            }
+        }
+    }
+}
+
 //=================================================================================
 // Main function
 //=================================================================================
@@ -207,7 +1096,22 @@ int main(int nofArgs, const char **args) {
                 std::cout << ".";
                 std::cout.flush();
             }
-            doRandomTest(randomSeed+i);
+            doRandomTest(randomSeed+i,0,1);
+            doRandomTest(randomSeed+i,i % 10 + 1,1);
+            doRandomTest(randomSeed+i,0,i % 4 + 2);
+            doRandomTest(randomSeed+i,i % 10 + 1,1,i % 5 + 2);
+            if ((i % 10)==0) doStateFileTest(randomSeed+i);
+            doCleanParetoFrontTest(randomSeed+i);
+            doBlockKernelTest(randomSeed+i);
+            if ((i % 10)==5) doPackedCoordinatesTest(randomSeed+i);
+            if ((i % 10)==7) doBudgetTest(randomSeed+i);
+            if ((i % 10)==3) doDistributedTest(randomSeed+i);
+            if ((i % 10)==9) doWarmStartTest(randomSeed+i);
+            if ((i % 10)==1) doOracleCacheTest(randomSeed+i);
+            if ((i % 10)==2) doAsyncTest(randomSeed+i);
+            if ((i % 10)==4) doMemoryLimitTest(randomSeed+i);
+            if ((i % 10)==6) doApproximationTest(randomSeed+i);
+            if ((i % 10)==8) doHypervolumeTest(randomSeed+i);
         }
         std::cout << "\nAll tests finished correctly.\n";
         return 0;
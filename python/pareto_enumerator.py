@@ -38,6 +38,12 @@ SOFTWARE.
 
 import sys,curses, random, unittest, itertools
 
+# The compiled C++ implementation (see "pareto_enumerator_native.cpp") is used whenever it has been built
+try:
+    import pareto_enumerator_native
+except ImportError:
+    pareto_enumerator_native = None
+
 #=========================================================
 # Tools
 #=========================================================
@@ -119,6 +125,12 @@ class NegativeAnswerBuffer:
 # Pareto enumeration function
 #=========================================================
 def computeParetoFront(fn,bounds):
+    if pareto_enumerator_native is not None:
+        # The native module returns the points as a two-dimensional buffer
+        return [tuple(point) for point in memoryview(pareto_enumerator_native.enumerateParetoFront(fn,bounds)).tolist()]
+    return computeParetoFrontInPython(fn,bounds)
+
+def computeParetoFrontInPython(fn,bounds):
     paretoSet = []
     restSet = [tuple([b for (a,b) in bounds])]
     negativePoints = NegativeAnswerBuffer()
@@ -131,7 +143,7 @@ def computeParetoFront(fn,bounds):
                 # Binary search
                 for i in range(0,len(bounds)):
                     maxi = thisOne[i]+1
-                    mini = 0
+                    mini = bounds[i][0]
                     while (maxi-mini)>1:
                         mid = mini+(maxi-mini-1)//2
                         testPoint = thisOne[0:i]+(mid,)+thisOne[i+1:]
@@ -159,7 +171,7 @@ def computeParetoFront(fn,bounds):
                         restSet.append(e)
                     else:
                         for i in range(0,len(bounds)):
-                            if thisOne[i]>0:
+                            if thisOne[i]>bounds[i][0]:
                                 restSet.append(e[0:i]+(thisOne[i]-1,)+e[i+1:])
                 restSet = list(cleanCoParetoSet(restSet))
             else:
@@ -296,6 +308,20 @@ class TestParetoRecurse(unittest.TestCase):
             paretoFront = computeParetoFront(lambda x,limit=a,data=oracleDataStorage : oracle3b(limit,data,x),[(0,40),(0,40),(0,40)])
             self.assertTrue(len(paretoFront)==3)
 
+    def testLowerLimits(self):
+        # Test 8: Objectives that do not start at 0. Points below the lower limits are never tested or returned.
+        def oracle4(limit,lowerLimits,values):
+            assert len(values)==2
+            assert values[0]>=lowerLimits[0] and values[1]>=lowerLimits[1]
+            return values[0]+values[1] >= limit
+
+        for i in range(0,40):
+            paretoFront = computeParetoFront(lambda x,limit=i : oracle4(limit,(5,3),x),[(5,20),(3,20)])
+            feasible = [(x,y) for x in range(5,21) for y in range(3,21) if x+y>=i]
+            expected = cleanParetoSet(feasible)
+            self.assertTrue(set(paretoFront)==expected)
+            self.assertTrue(len(paretoFront)==len(expected))
+
 
 # If called as main function, run Some tests
 if __name__ == "__main__":
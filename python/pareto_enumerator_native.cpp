@@ -0,0 +1,592 @@
+/*
+ * This is
+ *   pareto_enumerator_native.cpp
+ * that is part of the ParetoFrontEnumerationAlgorithm library, available from
+ *   https://github.com/progirep/ParetoFrontEnumerationAlgorithm
+ *
+ * Is ia a library for enumerating all elements of a Pareto front for a
+ * multi-criterial optimization problem for which all optimization objectives
+ * have a finite range.
+ *
+ * The library and all of its files are distributed under the following license:
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015-2016 Ruediger Ehlers
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+/*
+ * Python bindings for the C++ implementation, written against the C API of CPython so that they need nothing but the
+ * Python headers. The module offers "enumerateParetoFront" and "cleanParetoFront". Point sets are exchanged through the
+ * buffer protocol as C-contiguous two-dimensional arrays of C ints with one row per point, so that they are not copied
+ * point by point. Single points, and point sets that do not offer such a buffer, are read as sequences of integers instead.
+ * The C++ code runs without the global interpreter lock, which is only taken for calling the feasibility function.
+ */
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include "pareto_enumerator.hpp"
+#include <climits>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace paretoenumerator;
+
+/**
+ * @brief A Python exception that was raised by the feasibility function. It is taken out of the interpreter state of the
+ * thread that called the function, passed through the enumerator as a C++ exception, and raised again once the
+ * enumeration has stopped.
+ */
+class PythonError {
+    struct State {
+        PyObject *type, *value, *traceback;
+        State() { PyErr_Fetch(&type,&value,&traceback); }
+        ~State() {
+            // Dropped exceptions of other threads may be destroyed without holding the global interpreter lock
+            PyGILState_STATE gilState = PyGILState_Ensure();
+            Py_XDECREF(type);
+            Py_XDECREF(value);
+            Py_XDECREF(traceback);
+            PyGILState_Release(gilState);
+        }
+    };
+    std::shared_ptr<State> state;
+public:
+    PythonError() : state(new State()) {}
+    void restore() {
+        PyErr_Restore(state->type,state->value,state->traceback);
+        state->type = state->value = state->traceback = NULL;
+    }
+};
+
+/**
+ * @brief Releases the global interpreter lock for the lifetime of the object
+ */
+class ReleasedGIL {
+    PyThreadState *threadState;
+public:
+    ReleasedGIL() : threadState(PyEval_SaveThread()) {}
+    ~ReleasedGIL() { PyEval_RestoreThread(threadState); }
+};
+
+/**
+ * @brief Holds the global interpreter lock for the lifetime of the object, from whichever thread
+ */
+class AcquiredGIL {
+    PyGILState_STATE gilState;
+public:
+    AcquiredGIL() : gilState(PyGILState_Ensure()) {}
+    ~AcquiredGIL() { PyGILState_Release(gilState); }
+};
+
+/**
+ * @brief Reads a sequence of integers, e.g., a point given as a tuple, and appends it to "result"
+ */
+void appendIntegers(PyObject *sequence, const char *errorMessage, std::vector<int> &result) {
+    PyObject *fast = PySequence_Fast(sequence,errorMessage);
+    if (fast==NULL) throw PythonError();
+    const Py_ssize_t length = PySequence_Fast_GET_SIZE(fast);
+    for (Py_ssize_t i=0;i<length;i++) {
+        long value = PyLong_AsLong(PySequence_Fast_GET_ITEM(fast,i));
+        if ((value==-1) && PyErr_Occurred()) {
+            Py_DECREF(fast);
+            throw PythonError();
+        }
+        if ((value<INT_MIN) || (value>INT_MAX)) {
+            Py_DECREF(fast);
+            PyErr_SetString(PyExc_OverflowError,"Coordinates need to fit into a C++ int.");
+            throw PythonError();
+        }
+        result.push_back(static_cast<int>(value));
+    }
+    Py_DECREF(fast);
+}
+
+/**
+ * @brief Makes a tuple of "nofDimensions" integers
+ */
+PyObject *toTuple(const int *point, size_t nofDimensions) {
+    PyObject *tuple = PyTuple_New(static_cast<Py_ssize_t>(nofDimensions));
+    if (tuple==NULL) throw PythonError();
+    for (size_t i=0;i<nofDimensions;i++) {
+        PyObject *coordinate = PyLong_FromLong(point[i]);
+        if (coordinate==NULL) {
+            Py_DECREF(tuple);
+            throw PythonError();
+        }
+        PyTuple_SET_ITEM(tuple,static_cast<Py_ssize_t>(i),coordinate);
+    }
+    return tuple;
+}
+
+/**
+ * @brief Fills in a read-only, C-contiguous two-dimensional buffer of C ints over the coordinates of a point set. The shape
+ * and strides are written to the given arrays, which need to live as long as the buffer. "view.obj" is left to the caller.
+ */
+void fillPointSetBuffer(const PointSet &points, Py_ssize_t *shape, Py_ssize_t *strides, int flags, Py_buffer &view) {
+    // A buffer needs a valid address even if it is empty
+    static int emptyBuffer = 0;
+    shape[0] = static_cast<Py_ssize_t>(points.size());
+    shape[1] = static_cast<Py_ssize_t>(points.dimensions());
+    strides[0] = static_cast<Py_ssize_t>(points.dimensions()*sizeof(int));
+    strides[1] = static_cast<Py_ssize_t>(sizeof(int));
+    view.buf = points.coordinates().empty()?&emptyBuffer:const_cast<int*>(points.coordinates().data());
+    view.len = static_cast<Py_ssize_t>(points.coordinates().size()*sizeof(int));
+    view.readonly = 1;
+    view.itemsize = static_cast<Py_ssize_t>(sizeof(int));
+    view.format = ((flags & PyBUF_FORMAT)==PyBUF_FORMAT)?const_cast<char*>("i"):NULL;
+    view.ndim = 2;
+    view.shape = ((flags & PyBUF_ND)==PyBUF_ND)?shape:NULL;
+    view.strides = ((flags & PyBUF_STRIDES)==PyBUF_STRIDES)?strides:NULL;
+    view.suboffsets = NULL;
+    view.internal = NULL;
+}
+
+/**
+ * @brief The Python type of the point sets that the module returns. It owns a point set and exports its coordinates
+ * through the buffer protocol, so that, e.g., "memoryview(points).tolist()" or "numpy.asarray(points)" read them without
+ * a copy of every point as a tuple. The point set is never changed after the object has been created.
+ */
+struct PointSetObject {
+    PyObject_HEAD
+    PointSet *points;
+    Py_ssize_t shape[2];
+    Py_ssize_t strides[2];
+};
+
+// Created when the module is loaded
+PyTypeObject *pointSetType = NULL;
+
+void deallocatePointSetObject(PyObject *self) {
+    PyTypeObject *type = Py_TYPE(self);
+    delete reinterpret_cast<PointSetObject*>(self)->points;
+    PyObject_Free(self);
+    Py_DECREF(type);
+}
+
+int getPointSetObjectBuffer(PyObject *self, Py_buffer *view, int flags) {
+    if ((flags & PyBUF_WRITABLE)==PyBUF_WRITABLE) {
+        PyErr_SetString(PyExc_BufferError,"The point sets are read-only.");
+        view->obj = NULL;
+        return -1;
+    }
+    PointSetObject *pointSet = reinterpret_cast<PointSetObject*>(self);
+    fillPointSetBuffer(*(pointSet->points),pointSet->shape,pointSet->strides,flags,*view);
+    Py_INCREF(self);
+    view->obj = self;
+    return 0;
+}
+
+Py_ssize_t getPointSetObjectLength(PyObject *self) {
+    return static_cast<Py_ssize_t>(reinterpret_cast<PointSetObject*>(self)->points->size());
+}
+
+PyType_Slot pointSetSlots[] = {
+    {Py_tp_dealloc,reinterpret_cast<void*>(&deallocatePointSetObject)},
+    {Py_tp_doc,const_cast<char*>("A set of points with the same number of coordinates that offers them as a read-only two-dimensional buffer of C ints")},
+    {Py_sq_length,reinterpret_cast<void*>(&getPointSetObjectLength)},
+    {Py_bf_getbuffer,reinterpret_cast<void*>(&getPointSetObjectBuffer)},
+    {0,NULL}
+};
+
+PyType_Spec pointSetSpec = {"pareto_enumerator_native.PointSet",sizeof(PointSetObject),0,Py_TPFLAGS_DEFAULT,pointSetSlots};
+
+/**
+ * @brief Makes a Python point set that takes over the points of "points"
+ */
+PyObject *toPointSetObject(PointSet &points) {
+    PointSetObject *result = PyObject_New(PointSetObject,pointSetType);
+    if (result==NULL) throw PythonError();
+    result->points = NULL;
+    try {
+        result->points = new PointSet();
+    } catch (...) {
+        Py_DECREF(result);
+        throw;
+    }
+    result->points->swap(points);
+    return reinterpret_cast<PyObject*>(result);
+}
+
+/**
+ * @brief Returns whether a buffer format describes a C int in the native byte order
+ */
+bool isNativeIntFormat(const char *format) {
+    if (format==NULL) return false;
+    if ((*format=='@') || (*format=='=')) format++;
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__==__ORDER_LITTLE_ENDIAN__)
+    else if (*format=='<') format++;
+#endif
+    return (std::strcmp(format,"i")==0) || ((sizeof(long)==sizeof(int)) && (std::strcmp(format,"l")==0));
+}
+
+/**
+ * @brief Reads a point set from a C-contiguous two-dimensional buffer of C ints, if "object" offers one. Returns false
+ * (with no Python exception set) if it does not.
+ */
+bool readPointSetBuffer(PyObject *object, PointSet &result) {
+    if (!PyObject_CheckBuffer(object)) return false;
+    Py_buffer view;
+    if (PyObject_GetBuffer(object,&view,PyBUF_C_CONTIGUOUS | PyBUF_FORMAT)!=0) {
+        PyErr_Clear();
+        return false;
+    }
+    const bool usable = (view.ndim==2) && (view.itemsize==static_cast<Py_ssize_t>(sizeof(int))) && isNativeIntFormat(view.format);
+    if (usable) {
+        try {
+            PointSet points(static_cast<size_t>(view.shape[1]));
+            points.append(static_cast<const int*>(view.buf),static_cast<size_t>(view.shape[0]));
+            result.swap(points);
+        } catch (...) {
+            PyBuffer_Release(&view);
+            throw;
+        }
+    }
+    PyBuffer_Release(&view);
+    return usable;
+}
+
+/**
+ * @brief Reads a point set given as a sequence of points with "nofDimensions" coordinates each
+ */
+PointSet toPointSet(PyObject *sequence, size_t nofDimensions) {
+    PyObject *fast = PySequence_Fast(sequence,"The points need to be given as a sequence of points.");
+    if (fast==NULL) throw PythonError();
+    PointSet result(nofDimensions);
+    std::vector<int> point;
+    try {
+        for (Py_ssize_t i=0;i<PySequence_Fast_GET_SIZE(fast);i++) {
+            point.clear();
+            appendIntegers(PySequence_Fast_GET_ITEM(fast,i),"Every point needs to be a sequence of integers.",point);
+            if (point.size()!=nofDimensions) {
+                PyErr_SetString(PyExc_ValueError,"All points need to have the same number of coordinates.");
+                throw PythonError();
+            }
+            result.push_back(point);
+        }
+    } catch (...) {
+        Py_DECREF(fast);
+        throw;
+    }
+    Py_DECREF(fast);
+    return result;
+}
+
+/**
+ * @brief Reads a point set from a two-dimensional buffer of C ints or, if "object" does not offer one, from a sequence of
+ * points. The number of dimensions is then taken from the first point.
+ */
+PointSet readPointSet(PyObject *object) {
+    PointSet result;
+    if (readPointSetBuffer(object,result)) return result;
+
+    // Other buffers, e.g., of 64-bit integers or with gaps between the rows, are read through their elements
+    PyObject *sequence;
+    if (PyObject_CheckBuffer(object)) {
+        PyObject *memoryView = PyMemoryView_FromObject(object);
+        if (memoryView==NULL) throw PythonError();
+        sequence = PyObject_CallMethod(memoryView,"tolist",NULL);
+        Py_DECREF(memoryView);
+        if (sequence==NULL) throw PythonError();
+    } else {
+        sequence = object;
+        Py_INCREF(sequence);
+    }
+    try {
+        Py_ssize_t nofPoints = PySequence_Size(sequence);
+        if (nofPoints<0) throw PythonError();
+        Py_ssize_t nofDimensions = 0;
+        if (nofPoints>0) {
+            PyObject *firstPoint = PySequence_GetItem(sequence,0);
+            if (firstPoint==NULL) throw PythonError();
+            nofDimensions = PySequence_Size(firstPoint);
+            Py_DECREF(firstPoint);
+            if (nofDimensions<0) throw PythonError();
+        }
+        result = toPointSet(sequence,static_cast<size_t>(nofDimensions));
+    } catch (...) {
+        Py_DECREF(sequence);
+        throw;
+    }
+    Py_DECREF(sequence);
+    return result;
+}
+
+/**
+ * @brief Reads the limits, given as one (min,max) pair per objective
+ */
+std::vector<std::pair<int,int> > toLimits(PyObject *sequence) {
+    PyObject *fast = PySequence_Fast(sequence,"The limits need to be given as a sequence of (min,max) pairs.");
+    if (fast==NULL) throw PythonError();
+    std::vector<std::pair<int,int> > limits;
+    std::vector<int> limit;
+    try {
+        for (Py_ssize_t i=0;i<PySequence_Fast_GET_SIZE(fast);i++) {
+            limit.clear();
+            appendIntegers(PySequence_Fast_GET_ITEM(fast,i),"Every limit needs to be a (min,max) pair.",limit);
+            if (limit.size()!=2) {
+                PyErr_SetString(PyExc_ValueError,"The limits need to be given as pairs of the smallest and the largest value of every objective.");
+                throw PythonError();
+            }
+            limits.push_back(std::pair<int,int>(limit[0],limit[1]));
+        }
+    } catch (...) {
+        Py_DECREF(fast);
+        throw;
+    }
+    Py_DECREF(fast);
+    return limits;
+}
+
+/**
+ * @brief Calls "fn" on a single point. Must be called with the global interpreter lock held.
+ */
+bool callFeasibilityFunction(PyObject *fn, const std::vector<int> &point) {
+    PyObject *pointTuple = toTuple(point.data(),point.size());
+    PyObject *result = PyObject_CallFunctionObjArgs(fn,pointTuple,NULL);
+    Py_DECREF(pointTuple);
+    if (result==NULL) throw PythonError();
+    int truth = PyObject_IsTrue(result);
+    Py_DECREF(result);
+    if (truth<0) throw PythonError();
+    return truth!=0;
+}
+
+/**
+ * @brief Reads one truth value per point from a C-contiguous one-dimensional buffer of bools or bytes, if "results"
+ * offers one. Returns false (with no Python exception set) if it does not.
+ */
+bool readTruthValueBuffer(PyObject *results, size_t nofPoints, std::vector<bool> &truthValues) {
+    if (!PyObject_CheckBuffer(results)) return false;
+    Py_buffer view;
+    if (PyObject_GetBuffer(results,&view,PyBUF_C_CONTIGUOUS | PyBUF_FORMAT)!=0) {
+        PyErr_Clear();
+        return false;
+    }
+    const bool usable = (view.ndim==1) && (view.itemsize==1) && (view.format!=NULL) && ((std::strcmp(view.format,"?")==0) || (std::strcmp(view.format,"B")==0));
+    if (usable && (static_cast<size_t>(view.shape[0])!=nofPoints)) {
+        PyBuffer_Release(&view);
+        PyErr_SetString(PyExc_ValueError,"The batch feasibility function needs to return one truth value per point.");
+        throw PythonError();
+    }
+    if (usable) {
+        const unsigned char *values = static_cast<const unsigned char*>(view.buf);
+        truthValues.assign(nofPoints,false);
+        for (size_t i=0;i<nofPoints;i++) truthValues[i] = (values[i]!=0);
+    }
+    PyBuffer_Release(&view);
+    return usable;
+}
+
+/**
+ * @brief Calls the batch feasibility function "fn" on a read-only two-dimensional memoryview over the points in the batch,
+ * with one row per point. The truth values are read from a buffer of bools or bytes if "fn" returns one, and from a
+ * sequence otherwise. The memoryview is released afterwards, as the batch only lives until then. Must be called with the
+ * global interpreter lock held.
+ */
+std::vector<bool> callBatchFeasibilityFunction(PyObject *fn, const PointBatch &points) {
+    Py_ssize_t shape[2], strides[2];
+    Py_buffer view;
+    fillPointSetBuffer(points,shape,strides,PyBUF_FULL_RO,view);
+    view.obj = NULL;
+    PyObject *memoryView = PyMemoryView_FromBuffer(&view);
+    if (memoryView==NULL) throw PythonError();
+    PyObject *results = PyObject_CallFunctionObjArgs(fn,memoryView,NULL);
+    if (results==NULL) {
+        // The exception of "fn" has to be taken out of the interpreter state before calling "release"
+        PythonError error;
+        PyObject *released = PyObject_CallMethod(memoryView,"release",NULL);
+        if (released==NULL) PyErr_Clear();
+        Py_XDECREF(released);
+        Py_DECREF(memoryView);
+        throw error;
+    }
+    PyObject *released = PyObject_CallMethod(memoryView,"release",NULL);
+    Py_DECREF(memoryView);
+    if (released==NULL) {
+        // "fn" still holds a buffer that it got from the memoryview
+        Py_DECREF(results);
+        throw PythonError();
+    }
+    Py_DECREF(released);
+    std::vector<bool> truthValues;
+    try {
+        if (readTruthValueBuffer(results,points.size(),truthValues)) {
+            Py_DECREF(results);
+            return truthValues;
+        }
+    } catch (...) {
+        Py_DECREF(results);
+        throw;
+    }
+    PyObject *fast = PySequence_Fast(results,"The batch feasibility function needs to return a sequence of truth values.");
+    Py_DECREF(results);
+    if (fast==NULL) throw PythonError();
+    if (static_cast<size_t>(PySequence_Fast_GET_SIZE(fast))!=points.size()) {
+        Py_DECREF(fast);
+        PyErr_SetString(PyExc_ValueError,"The batch feasibility function needs to return one truth value per point.");
+        throw PythonError();
+    }
+    truthValues.resize(points.size());
+    for (size_t i=0;i<points.size();i++) {
+        int truth = PyObject_IsTrue(PySequence_Fast_GET_ITEM(fast,static_cast<Py_ssize_t>(i)));
+        if (truth<0) {
+            Py_DECREF(fast);
+            throw PythonError();
+        }
+        truthValues[i] = (truth!=0);
+    }
+    Py_DECREF(fast);
+    return truthValues;
+}
+
+/**
+ * @brief Runs "body", which returns a new reference, and translates the exceptions that it throws into Python exceptions.
+ * The library reports errors as "const char *" messages.
+ */
+template<class Body> PyObject *translateExceptions(const Body &body) {
+    try {
+        return body();
+    } catch (PythonError &error) {
+        error.restore();
+    } catch (const char *message) {
+        PyErr_SetString(PyExc_ValueError,message);
+    } catch (const std::bad_alloc &) {
+        PyErr_NoMemory();
+    } catch (const std::exception &error) {
+        PyErr_SetString(PyExc_RuntimeError,error.what());
+    }
+    return NULL;
+}
+
+const char enumerateParetoFrontDoc[] =
+    "enumerateParetoFront(fn, limits, batch=False, maxBatchSize=..., nofThreads=1, searchArity=1, timeBudget=..., "
+    "oracleCallBudget=..., approximationTolerance=())\n\n"
+    "Enumerates the Pareto front of a monotone feasibility function \"fn\" within the given limits, one (min,max) pair "
+    "per objective, and returns it as a point set that offers its points as a read-only two-dimensional buffer of C ints, "
+    "e.g., through \"memoryview(front).tolist()\". \"fn\" gets a point as a tuple. With batch=True, \"fn\" gets up to "
+    "maxBatchSize points as a read-only two-dimensional memoryview, which is only valid during the call, and returns one "
+    "truth value per point, as a buffer of bools or bytes or as a sequence.";
+
+PyObject *enumerateParetoFrontForPython(PyObject *, PyObject *args, PyObject *kwargs) {
+    static const char *keywords[] = {"fn","limits","batch","maxBatchSize","nofThreads","searchArity","timeBudget","oracleCallBudget","approximationTolerance",NULL};
+    EnumerationOptions options;
+    PyObject *fn;
+    PyObject *limitsObject;
+    int batch = 0;
+    unsigned long long maxBatchSize = options.maxBatchSize;
+    unsigned long long oracleCallBudget = options.oracleCallBudget;
+    PyObject *toleranceObject = NULL;
+    if (!PyArg_ParseTupleAndKeywords(args,kwargs,"OO|pKIIdKO:enumerateParetoFront",const_cast<char**>(keywords),&fn,&limitsObject,
+        &batch,&maxBatchSize,&options.nofThreads,&options.searchArity,&options.timeBudget,&oracleCallBudget,&toleranceObject)) return NULL;
+    if (!PyCallable_Check(fn)) {
+        PyErr_SetString(PyExc_TypeError,"The feasibility function needs to be callable.");
+        return NULL;
+    }
+    options.maxBatchSize = static_cast<size_t>(maxBatchSize);
+    options.oracleCallBudget = static_cast<size_t>(oracleCallBudget);
+
+    return translateExceptions([&] () -> PyObject * {
+        std::vector<std::pair<int,int> > limits = toLimits(limitsObject);
+        if (toleranceObject!=NULL) appendIntegers(toleranceObject,"The approximation tolerance needs to be a sequence of integers.",options.approximationTolerance);
+
+        PointSet paretoFront;
+        if (batch) {
+            std::function<std::vector<bool>(const PointBatch &)> batchFunction = [fn] (const PointBatch &points) {
+                AcquiredGIL gil;
+                return callBatchFeasibilityFunction(fn,points);
+            };
+            ReleasedGIL released;
+            enumerateParetoFront(batchFunction,limits,paretoFront,options);
+        } else {
+            std::function<bool(const std::vector<int> &)> pointFunction = [fn] (const std::vector<int> &point) {
+                AcquiredGIL gil;
+                return callFeasibilityFunction(fn,point);
+            };
+            ReleasedGIL released;
+            enumerateParetoFront(pointFunction,limits,paretoFront,options);
+        }
+        return toPointSetObject(paretoFront);
+    });
+}
+
+const char cleanParetoFrontDoc[] =
+    "cleanParetoFront(points, nofThreads=1)\n\n"
+    "Removes all dominating elements like the C++ function of the same name, i.e., the points that are pointwise smaller "
+    "than another point, and returns the others in their original order as a point set like \"enumerateParetoFront\". "
+    "Points that are equal to each other are kept. \"points\" is read as a two-dimensional buffer of C ints if it offers "
+    "one, and as a sequence of sequences of integers otherwise.";
+
+PyObject *cleanParetoFrontForPython(PyObject *, PyObject *args, PyObject *kwargs) {
+    static const char *keywords[] = {"points","nofThreads",NULL};
+    PyObject *pointsObject;
+    unsigned int nofThreads = 1;
+    if (!PyArg_ParseTupleAndKeywords(args,kwargs,"O|I:cleanParetoFront",const_cast<char**>(keywords),&pointsObject,&nofThreads)) return NULL;
+
+    return translateExceptions([&] () -> PyObject * {
+        PointSet input = readPointSet(pointsObject);
+        PointSet cleaned;
+        {
+            ReleasedGIL released;
+            cleaned = (nofThreads>1)?cleanParetoFront(input,nofThreads):cleanParetoFront(input);
+        }
+        return toPointSetObject(cleaned);
+    });
+}
+
+PyMethodDef methods[] = {
+    {"enumerateParetoFront",reinterpret_cast<PyCFunction>(reinterpret_cast<void(*)()>(&enumerateParetoFrontForPython)),METH_VARARGS | METH_KEYWORDS,enumerateParetoFrontDoc},
+    {"cleanParetoFront",reinterpret_cast<PyCFunction>(reinterpret_cast<void(*)()>(&cleanParetoFrontForPython)),METH_VARARGS | METH_KEYWORDS,cleanParetoFrontDoc},
+    {NULL,NULL,0,NULL}
+};
+
+PyModuleDef moduleDefinition = {
+    PyModuleDef_HEAD_INIT,
+    "pareto_enumerator_native",
+    "Enumeration of the Pareto front of a multi-criterial optimization problem with finite objective ranges",
+    -1,
+    methods,
+    NULL,NULL,NULL,NULL
+};
+
+PyMODINIT_FUNC PyInit_pareto_enumerator_native() {
+    PyObject *module = PyModule_Create(&moduleDefinition);
+    if (module==NULL) return NULL;
+    pointSetType = reinterpret_cast<PyTypeObject*>(PyType_FromSpec(&pointSetSpec));
+    if (pointSetType==NULL) {
+        Py_DECREF(module);
+        return NULL;
+    }
+    // Point sets are only made by the functions of the module
+    pointSetType->tp_new = NULL;
+    // The module keeps one reference, and "pointSetType" another one, as the module cannot be unloaded
+    Py_INCREF(pointSetType);
+    if (PyModule_AddObject(module,"PointSet",reinterpret_cast<PyObject*>(pointSetType))<0) {
+        Py_DECREF(pointSetType);
+        Py_DECREF(module);
+        return NULL;
+    }
+    return module;
+}